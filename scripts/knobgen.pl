@@ -17,6 +17,8 @@ my @headerDeclares = ();
 my @constructors = ();
 my @registerCalls = ();
 my @deconstructs = ();
+my @valueDeclares = ();
+my @snapshotCalls = ();
 
 ##### START #####
 
@@ -113,6 +115,8 @@ sub parseFile
   push(@headerDeclares, "\n\n\t// =========== $file ===========\n");
   push(@constructors,   "\n\n\t// =========== $file ===========\n");
   push(@registerCalls,  "\n\n\t// =========== $file ===========\n");
+  push(@valueDeclares,  "\n\n\t// =========== $file ===========\n");
+  push(@snapshotCalls,  "\n\n\t// =========== $file ===========\n");
   foreach $param_line (@param_lines) {
     processLine($param_line);
   }
@@ -165,6 +169,11 @@ sub processLine
     push(@headerDeclares, "KnobTemplate< $datatype >* $KnobName;\n");
     push(@registerCalls,  "container->insertKnob( $KnobName );\n");
     push(@deconstructs,   "delete $KnobName;\n");
+    # string knobs stay behind KNOB(); the snapshot only holds plain values
+    if ($datatype ne "string") {
+      push(@valueDeclares, "$datatype $KnobName;\n");
+      push(@snapshotCalls, "values->$KnobName = $KnobName->getValue();\n");
+    }
     if ($elements[2] =~ /\s*string\s*/) {
       if ($parentName ne "") {
         push(@constructors, "$KnobName = new KnobTemplate< $datatype > (\"$paramfileentry\", \"$defaultvalue\", \"$parentName\");\n");
@@ -215,6 +224,14 @@ sub writeSource
   }
   print ALLKNOBS_C "}\n\n";
   
+  
+  #snapshot function
+  print ALLKNOBS_C "void all_knobs_c::snapshot(all_knob_values_s *values) const {\n";
+  foreach $snapshotCall (@snapshotCalls) {
+    print ALLKNOBS_C "\t$snapshotCall";
+  }
+  print ALLKNOBS_C "}\n\n";
+  
 }
 ################################################################################
 
@@ -228,6 +245,20 @@ sub writeHeader
   print ALLKNOBS_H "#include \"knob.h\"\n\n";
 
   print ALLKNOBS_H "#define KNOB(var) m_simBase->m_knobs->var\n\n"; 
+  print ALLKNOBS_H "// read a knob from the snapshot bound by the component (m_knob_values)\n";
+  print ALLKNOBS_H "#define KNOB_VALUE(var) m_knob_values->var\n\n";
+  
+  print ALLKNOBS_H "///////////////////////////////////////////////////////////////////////////////////////////////\n";
+  print ALLKNOBS_H "/// \\brief read-only copy of all non-string knob values\n";
+  print ALLKNOBS_H "///\n";
+  print ALLKNOBS_H "/// Filled once after the parameter file and command line are applied. Hot paths\n";
+  print ALLKNOBS_H "/// read plain fields instead of going through the knob objects.\n";
+  print ALLKNOBS_H "///////////////////////////////////////////////////////////////////////////////////////////////\n";
+  print ALLKNOBS_H "struct all_knob_values_s {\n";
+  foreach $valdef (@valueDeclares) {
+    print ALLKNOBS_H "\t$valdef";
+  }
+  print ALLKNOBS_H "\n};\n\n";
   
   print ALLKNOBS_H "///////////////////////////////////////////////////////////////////////////////////////////////\n";
   print ALLKNOBS_H "/// \\brief knob variables holder\n";
@@ -248,6 +279,10 @@ sub writeHeader
   print ALLKNOBS_H "\t\t * Register Knob Variables\n";
   print ALLKNOBS_H "\t\t */\n";
   print ALLKNOBS_H "\t\tvoid registerKnobs(KnobsContainer *container);\n\n";
+  print ALLKNOBS_H "\t\t/**\n";
+  print ALLKNOBS_H "\t\t * Copy current knob values into a plain structure\n";
+  print ALLKNOBS_H "\t\t */\n";
+  print ALLKNOBS_H "\t\tvoid snapshot(all_knob_values_s *values) const;\n\n";
   
   print ALLKNOBS_H "\tpublic:\n";
   foreach $vardef (@headerDeclares) {
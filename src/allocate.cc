@@ -115,50 +115,17 @@ void allocate_c::run_a_cycle(void) {
     // -------------------------------------
     // check resource requirement
     // -------------------------------------
-    int req_rob = 1;  // require rob entries
     int req_sb = 0;  // require store buffer entries
     int req_lb = 0;  // require load buffer entries
     int req_int_reg = 0;  // require integer register
     int req_fp_reg = 0;  // require fp register
-    int req_simd_reg = 0;  // require simd register
-    int q_type = *m_simBase->m_knobs->KNOB_GEN_ALLOCQ_INDEX;
-
-    if (uop->m_mem_type == MEM_LD)  // load queue
-      req_lb = 1;
-    else if (uop->m_mem_type == MEM_ST)  // store queue
-      req_sb = 1;
-    else if (uop->m_uop_type == UOP_IADD ||  // integer register
-             uop->m_uop_type == UOP_IMUL || uop->m_uop_type == UOP_ICMP)
-      req_int_reg = 1;
-    else if (uop->m_uop_type == UOP_FCVT ||
-             uop->m_uop_type == UOP_FADD)  // fp register
-      req_fp_reg = 1;
-    else if (uop->m_uop_type == UOP_SIMD)  // simd register
-      req_simd_reg = 1;
-
-    // single allocation queue
-    if (m_num_queues == 1) {
-      q_type = *m_simBase->m_knobs->KNOB_GEN_ALLOCQ_INDEX;
-    }
-    // multiple allocation queues
-    else {
-      if (req_fp_reg)
-        q_type = *m_simBase->m_knobs->KNOB_FLOAT_ALLOCQ_INDEX;
-      else if (req_simd_reg)
-        q_type = *m_simBase->m_knobs->KNOB_SIMD_ALLOCQ_INDEX;
-      else if (req_sb || req_lb)
-        q_type = *m_simBase->m_knobs->KNOB_MEM_ALLOCQ_INDEX;
-      else
-        q_type = *m_simBase->m_knobs->KNOB_GEN_ALLOCQ_INDEX;
-    }
+    int q_type =
+      get_resource_req(uop, &req_sb, &req_lb, &req_int_reg, &req_fp_reg);
 
     pqueue_c<int> *alloc_q = m_alloc_q[q_type];
 
     // check rob and other physical resources
-    if (m_rob->space() < req_rob || m_resource->get_num_sb() < req_sb ||
-        m_resource->get_num_lb() < req_lb || alloc_q->space() < 1 ||
-        m_resource->get_num_int_regs() < req_int_reg ||
-        m_resource->get_num_fp_regs() < req_fp_reg) {
+    if (!has_resource(q_type, req_sb, req_lb, req_int_reg, req_fp_reg)) {
       DEBUG_CORE(m_core_id,
                  "not enough physical resources: rob_space:%d num_sb:%d "
                  "num_lb:%d alloc_q:%d int_reg:%d fp_reg:%d \n",
@@ -252,3 +219,63 @@ void allocate_c::run_a_cycle(void) {
     }
   }
 }
+
+// find resource requirement and allocation queue type of an uop
+int allocate_c::get_resource_req(uop_c *uop, int *req_sb, int *req_lb,
+                                 int *req_int_reg, int *req_fp_reg) {
+  int req_simd_reg = 0;  // require simd register
+
+  if (uop->m_mem_type == MEM_LD)  // load queue
+    *req_lb = 1;
+  else if (uop->m_mem_type == MEM_ST)  // store queue
+    *req_sb = 1;
+  else if (uop->m_uop_type == UOP_IADD ||  // integer register
+           uop->m_uop_type == UOP_IMUL || uop->m_uop_type == UOP_ICMP)
+    *req_int_reg = 1;
+  else if (uop->m_uop_type == UOP_FCVT ||
+           uop->m_uop_type == UOP_FADD)  // fp register
+    *req_fp_reg = 1;
+  else if (uop->m_uop_type == UOP_SIMD)  // simd register
+    req_simd_reg = 1;
+
+  // single allocation queue
+  if (m_num_queues == 1) return *m_simBase->m_knobs->KNOB_GEN_ALLOCQ_INDEX;
+
+  // multiple allocation queues
+  if (*req_fp_reg)
+    return *m_simBase->m_knobs->KNOB_FLOAT_ALLOCQ_INDEX;
+  else if (req_simd_reg)
+    return *m_simBase->m_knobs->KNOB_SIMD_ALLOCQ_INDEX;
+  else if (*req_sb || *req_lb)
+    return *m_simBase->m_knobs->KNOB_MEM_ALLOCQ_INDEX;
+  else
+    return *m_simBase->m_knobs->KNOB_GEN_ALLOCQ_INDEX;
+}
+
+// check rob and other physical resources
+bool allocate_c::has_resource(int q_type, int req_sb, int req_lb,
+                              int req_int_reg, int req_fp_reg) {
+  int req_rob = 1;  // require rob entries
+
+  return !(m_rob->space() < req_rob || m_resource->get_num_sb() < req_sb ||
+           m_resource->get_num_lb() < req_lb || m_alloc_q[q_type]->space() < 1 ||
+           m_resource->get_num_int_regs() < req_int_reg ||
+           m_resource->get_num_fp_regs() < req_fp_reg);
+}
+
+// allocation is stalled until resources are released by later stages
+Counter allocate_c::get_idle_cycles(void) {
+  if (!m_frontend_q->ready()) return ULLONG_MAX;
+
+  uop_c *uop = (uop_c *)m_frontend_q->peek(0);
+  int req_sb = 0;
+  int req_lb = 0;
+  int req_int_reg = 0;
+  int req_fp_reg = 0;
+  int q_type =
+    get_resource_req(uop, &req_sb, &req_lb, &req_int_reg, &req_fp_reg);
+
+  if (has_resource(q_type, req_sb, req_lb, req_int_reg, req_fp_reg)) return 0;
+
+  return ULLONG_MAX;
+}
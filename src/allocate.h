@@ -123,6 +123,12 @@ public:
    */
   void run_a_cycle();
 
+  /** \fn get_idle_cycles()
+   *  \brief Number of upcoming cycles in which nothing can be allocated.
+   *  \return Counter - 0 if busy, ULLONG_MAX if waiting for other stages
+   */
+  Counter get_idle_cycles();
+
   /*! \fn start()
    *  \brief Mark allocation as running
    *  \return void
@@ -147,6 +153,19 @@ public:
     return m_allocate_running;
   }
 
+private:
+  /**
+   * Find resource requirement of an uop and return its allocation queue type
+   */
+  int get_resource_req(uop_c* uop, int* req_sb, int* req_lb, int* req_int_reg,
+                       int* req_fp_reg);
+
+  /**
+   * Check rob and other physical resources for the requirement
+   */
+  bool has_resource(int q_type, int req_sb, int req_lb, int req_int_reg,
+                    int req_fp_reg);
+
 private:
   int m_core_id; /**< core id */
   pqueue_c<int*>* m_frontend_q; /**< frontend queue */
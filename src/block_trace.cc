@@ -0,0 +1,372 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : block_trace.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Seekable block-compressed trace container (reader and writer)
+ *********************************************************************************************/
+
+#include <cstring>
+#include <zlib.h>
+
+#include "block_trace.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// block_trace_reader_c constructor
+block_trace_reader_c::block_trace_reader_c() {
+  m_file = NULL;
+  m_block_size = 0;
+  m_size = 0;
+  m_position = 0;
+  m_loaded_block = -1;
+  m_is_delta = false;
+}
+
+// block_trace_reader_c destructor
+block_trace_reader_c::~block_trace_reader_c() {
+  close();
+}
+
+// check the magic number at the beginning of a file
+bool block_trace_reader_c::is_block_trace(const std::string& filename) {
+  FILE* file = fopen(filename.c_str(), "rb");
+  if (file == NULL) return false;
+
+  block_trace_header_s header;
+  bool result = fread(&header, sizeof(header), 1, file) == 1 &&
+                header.m_magic == BLOCK_TRACE_MAGIC;
+  fclose(file);
+
+  return result;
+}
+
+// open a block trace and load its index
+bool block_trace_reader_c::open(const std::string& filename) {
+  close();
+
+  m_file = fopen(filename.c_str(), "rb");
+  if (m_file == NULL) {
+    m_error = "cannot open " + filename;
+    return false;
+  }
+
+  block_trace_header_s header;
+  block_trace_trailer_s trailer;
+  if (fread(&header, sizeof(header), 1, m_file) != 1 ||
+      header.m_magic != BLOCK_TRACE_MAGIC || header.m_block_size == 0 ||
+      fseeko(m_file, -static_cast<off_t>(sizeof(trailer)), SEEK_END) != 0 ||
+      fread(&trailer, sizeof(trailer), 1, m_file) != 1 ||
+      trailer.m_magic != BLOCK_TRACE_MAGIC ||
+      trailer.m_version != header.m_version ||
+      (header.m_version != BLOCK_TRACE_VERSION &&
+       header.m_version != BLOCK_TRACE_VERSION_DELTA)) {
+    m_error = filename + " is not a block trace";
+    close();
+    return false;
+  }
+
+  // record layout of a delta trace
+  m_is_delta = header.m_version == BLOCK_TRACE_VERSION_DELTA;
+  if (m_is_delta) {
+    block_trace_layout_s layout;
+    std::vector<delta_trace_field_s> fields;
+    bool valid = fseeko(m_file, sizeof(header), SEEK_SET) == 0 &&
+                 fread(&layout, sizeof(layout), 1, m_file) == 1 &&
+                 layout.m_num_field > 0 && layout.m_num_field <= DELTA_TRACE_MAX_FIELD + 1;
+    if (valid) {
+      fields.resize(layout.m_num_field);
+      valid = fread(fields.data(), sizeof(delta_trace_field_s), layout.m_num_field,
+                    m_file) == layout.m_num_field;
+    }
+    if (valid) {
+      m_codec = delta_trace_codec_c();
+      for (auto I = fields.begin(), E = fields.end(); I != E; ++I)
+        m_codec.add_field((*I).m_offset, (*I).m_size, (*I).m_kind);
+      valid = m_codec.set_record_size(layout.m_record_size) &&
+              header.m_block_size % layout.m_record_size == 0;
+    }
+    if (!valid) {
+      m_error = "corrupted record layout in " + filename;
+      close();
+      return false;
+    }
+    m_encoded.resize(m_codec.encode_bound(header.m_block_size));
+  }
+
+  m_index.resize(trailer.m_num_block);
+  if (fseeko(m_file, trailer.m_index_offset, SEEK_SET) != 0 ||
+      (trailer.m_num_block &&
+       fread(m_index.data(), sizeof(block_trace_index_s), trailer.m_num_block,
+             m_file) != trailer.m_num_block)) {
+    m_error = "corrupted block index in " + filename;
+    close();
+    return false;
+  }
+
+  m_block_size = header.m_block_size;
+  m_size = trailer.m_size;
+  m_position = 0;
+  m_loaded_block = -1;
+  m_data.resize(m_block_size);
+  m_error.clear();
+
+  return true;
+}
+
+// close the file
+void block_trace_reader_c::close(void) {
+  if (m_file) {
+    fclose(m_file);
+    m_file = NULL;
+  }
+  m_index.clear();
+  m_loaded_block = -1;
+}
+
+// inflate a block
+bool block_trace_reader_c::load_block(uint64_t block) {
+  block_trace_index_s& entry = m_index[block];
+
+  m_compressed.resize(entry.m_compressed_size);
+  if (fseeko(m_file, entry.m_offset, SEEK_SET) != 0 ||
+      fread(m_compressed.data(), 1, entry.m_compressed_size, m_file) !=
+        entry.m_compressed_size) {
+    m_error = "cannot read trace block";
+    return false;
+  }
+
+  if (m_is_delta) {
+    uLongf size = m_encoded.size();
+    if (uncompress(reinterpret_cast<Bytef*>(m_encoded.data()), &size,
+                   reinterpret_cast<Bytef*>(m_compressed.data()),
+                   entry.m_compressed_size) != Z_OK ||
+        entry.m_size > m_block_size ||
+        !m_codec.decode(m_encoded.data(), size, m_data.data(), entry.m_size)) {
+      m_error = "cannot decode trace block";
+      return false;
+    }
+  } else {
+    uLongf size = m_block_size;
+    if (uncompress(reinterpret_cast<Bytef*>(m_data.data()), &size,
+                   reinterpret_cast<Bytef*>(m_compressed.data()),
+                   entry.m_compressed_size) != Z_OK ||
+        size != entry.m_size) {
+      m_error = "cannot inflate trace block";
+      return false;
+    }
+  }
+
+  m_loaded_block = block;
+  return true;
+}
+
+// read len bytes from the current position
+int block_trace_reader_c::read(void* buf, unsigned len) {
+  if (m_file == NULL) return -1;
+
+  char* dst = static_cast<char*>(buf);
+  unsigned copied = 0;
+  while (copied < len && m_position < m_size) {
+    uint64_t block = m_position / m_block_size;
+    if (static_cast<int64_t>(block) != m_loaded_block && !load_block(block)) return -1;
+
+    uint64_t offset = m_position - block * m_block_size;
+    uint64_t size = m_index[block].m_size - offset;
+    if (size > len - copied) size = len - copied;
+
+    memcpy(dst + copied, m_data.data() + offset, size);
+    copied += size;
+    m_position += size;
+  }
+
+  return copied;
+}
+
+// set the read position; the target block is inflated by the next read
+off_t block_trace_reader_c::seek(off_t offset, int whence) {
+  if (m_file == NULL) return -1;
+
+  if (whence != SEEK_SET && whence != SEEK_CUR) return -1;
+
+  off_t target = (whence == SEEK_CUR) ? m_position + offset : offset;
+  if (target < 0 || static_cast<uint64_t>(target) > m_size) return -1;
+
+  m_position = target;
+  return target;
+}
+
+// last error message
+const char* block_trace_reader_c::error(void) {
+  return m_error.c_str();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// block_trace_writer_c constructor
+block_trace_writer_c::block_trace_writer_c() {
+  m_file = NULL;
+  m_block_size = 0;
+  m_offset = 0;
+  m_size = 0;
+  m_is_delta = false;
+  m_version = BLOCK_TRACE_VERSION;
+}
+
+// block_trace_writer_c destructor
+block_trace_writer_c::~block_trace_writer_c() {
+  if (m_file) close();
+}
+
+// create a block trace
+bool block_trace_writer_c::open(const std::string& filename, uint32_t block_size,
+                                const delta_trace_codec_c* codec) {
+  if (block_size == 0) return false;
+
+  m_is_delta = codec != NULL;
+  if (m_is_delta) {
+    if (codec->get_record_size() == 0 || block_size % codec->get_record_size()) return false;
+    m_codec = *codec;
+  }
+  m_version = m_is_delta ? BLOCK_TRACE_VERSION_DELTA : BLOCK_TRACE_VERSION;
+
+  m_file = fopen(filename.c_str(), "wb");
+  if (m_file == NULL) return false;
+
+  block_trace_header_s header;
+  header.m_magic = BLOCK_TRACE_MAGIC;
+  header.m_version = m_version;
+  header.m_block_size = block_size;
+  header.m_reserved = 0;
+  bool valid = fwrite(&header, sizeof(header), 1, m_file) == 1;
+  m_offset = sizeof(header);
+
+  if (valid && m_is_delta) {
+    const std::vector<delta_trace_field_s>& fields = m_codec.get_fields();
+    block_trace_layout_s layout;
+    layout.m_record_size = m_codec.get_record_size();
+    layout.m_num_field = fields.size();
+    valid = fwrite(&layout, sizeof(layout), 1, m_file) == 1 &&
+            fwrite(fields.data(), sizeof(delta_trace_field_s), fields.size(),
+                   m_file) == fields.size();
+    m_offset += sizeof(layout) + sizeof(delta_trace_field_s) * fields.size();
+    m_encoded.reserve(m_codec.encode_bound(block_size));
+  }
+
+  // do not leave a truncated file that close() would complete with a trailer
+  if (!valid) {
+    fclose(m_file);
+    m_file = NULL;
+    remove(filename.c_str());
+    return false;
+  }
+
+  m_block_size = block_size;
+  m_size = 0;
+  m_index.clear();
+  m_data.clear();
+  m_data.reserve(block_size);
+  m_compressed.resize(
+    compressBound(m_is_delta ? m_codec.encode_bound(block_size) : block_size));
+
+  return true;
+}
+
+// append len bytes
+bool block_trace_writer_c::write(const void* buf, unsigned len) {
+  const char* src = static_cast<const char*>(buf);
+  while (len > 0) {
+    unsigned size = m_block_size - m_data.size();
+    if (size > len) size = len;
+
+    m_data.insert(m_data.end(), src, src + size);
+    src += size;
+    len -= size;
+    m_size += size;
+
+    if (m_data.size() == m_block_size && !flush_block()) return false;
+  }
+
+  return true;
+}
+
+// compress and write the pending block
+bool block_trace_writer_c::flush_block(void) {
+  if (m_data.empty()) return true;
+
+  std::vector<char>* data = &m_data;
+  if (m_is_delta) {
+    m_encoded.clear();
+    m_codec.encode(m_data.data(), m_data.size(), m_encoded);
+    data = &m_encoded;
+  }
+
+  uLongf size = m_compressed.size();
+  if (compress2(reinterpret_cast<Bytef*>(m_compressed.data()), &size,
+                reinterpret_cast<Bytef*>(data->data()), data->size(),
+                Z_DEFAULT_COMPRESSION) != Z_OK ||
+      fwrite(m_compressed.data(), 1, size, m_file) != size) {
+    return false;
+  }
+
+  block_trace_index_s entry;
+  entry.m_offset = m_offset;
+  entry.m_compressed_size = size;
+  entry.m_size = m_data.size();
+  m_index.push_back(entry);
+
+  m_offset += size;
+  m_data.clear();
+
+  return true;
+}
+
+// flush the last block, then write the index and the trailer
+bool block_trace_writer_c::close(void) {
+  bool result = flush_block();
+
+  block_trace_trailer_s trailer;
+  trailer.m_num_block = m_index.size();
+  trailer.m_index_offset = m_offset;
+  trailer.m_size = m_size;
+  trailer.m_magic = BLOCK_TRACE_MAGIC;
+  trailer.m_version = m_version;
+
+  if (result && !m_index.empty())
+    result = fwrite(m_index.data(), sizeof(block_trace_index_s), m_index.size(),
+                    m_file) == m_index.size();
+  if (result) result = fwrite(&trailer, sizeof(trailer), 1, m_file) == 1;
+
+  result = (fclose(m_file) == 0) && result;
+  m_file = NULL;
+
+  return result;
+}
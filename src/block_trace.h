@@ -0,0 +1,213 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : block_trace.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Seekable block-compressed trace container (reader and writer)
+ *********************************************************************************************/
+
+#ifndef BLOCK_TRACE_H_INCLUDED
+#define BLOCK_TRACE_H_INCLUDED
+
+#include <cstdio>
+#include <inttypes.h>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+#include "delta_trace.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// Block trace file layout
+///
+/// header | block 0 | block 1 | ... | block n-1 | index (n entries) | trailer
+///
+/// Every block holds block_size bytes of the original (uncompressed) trace, except the last
+/// one, and is compressed independently with zlib. The index at the end of the file gives the
+/// location of each block, so any byte of the trace can be reached by inflating one block.
+///
+/// Version 2 (delta) files store a record layout right after the header
+/// (block_trace_layout_s followed by the fields) and delta-encode the records of each block
+/// (see delta_trace.h) before compressing it. Blocks hold a whole number of records and the
+/// per-pc table is reset at every block, so seeking still costs at most one block.
+///////////////////////////////////////////////////////////////////////////////////////////////
+#define BLOCK_TRACE_MAGIC 0x5442534d  // "MSBT"
+#define BLOCK_TRACE_VERSION 1
+#define BLOCK_TRACE_VERSION_DELTA 2
+
+typedef struct block_trace_header_s {
+  uint32_t m_magic; /**< BLOCK_TRACE_MAGIC */
+  uint32_t m_version; /**< format version */
+  uint32_t m_block_size; /**< uncompressed bytes per block */
+  uint32_t m_reserved; /**< reserved */
+} block_trace_header_s;
+
+typedef struct block_trace_layout_s {
+  uint32_t m_record_size; /**< record size */
+  uint32_t m_num_field; /**< number of delta_trace_field_s entries that follow */
+} block_trace_layout_s;
+
+typedef struct block_trace_index_s {
+  uint64_t m_offset; /**< file offset of the compressed block */
+  uint32_t m_compressed_size; /**< compressed block size */
+  uint32_t m_size; /**< uncompressed block size */
+} block_trace_index_s;
+
+typedef struct block_trace_trailer_s {
+  uint64_t m_num_block; /**< number of blocks */
+  uint64_t m_index_offset; /**< file offset of the index */
+  uint64_t m_size; /**< uncompressed trace size */
+  uint32_t m_magic; /**< BLOCK_TRACE_MAGIC */
+  uint32_t m_version; /**< format version */
+} block_trace_trailer_s;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Block trace reader
+///
+/// Provides gzread/gzseek-like access to a block trace. Only the block that holds the current
+/// position is kept inflated, so seeking anywhere costs at most one block inflation.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class block_trace_reader_c
+{
+public:
+  /**
+   * Constructor
+   */
+  block_trace_reader_c();
+
+  /**
+   * Destructor
+   */
+  ~block_trace_reader_c();
+
+  /**
+   * Open a block trace. Returns false if the file is not a block trace
+   */
+  bool open(const std::string& filename);
+
+  /**
+   * Close the file
+   */
+  void close(void);
+
+  /**
+   * Read len bytes (bytes read, 0 at the end of the trace, -1 on error)
+   */
+  int read(void* buf, unsigned len);
+
+  /**
+   * Set the read position (SEEK_SET or SEEK_CUR). Returns the new position, -1 on error
+   */
+  off_t seek(off_t offset, int whence);
+
+  /**
+   * Last error message
+   */
+  const char* error(void);
+
+  /**
+   * Check whether a file is a block trace
+   */
+  static bool is_block_trace(const std::string& filename);
+
+private:
+  /**
+   * Inflate a block into m_data
+   */
+  bool load_block(uint64_t block);
+
+  FILE* m_file; /**< trace file */
+  uint32_t m_block_size; /**< uncompressed bytes per block */
+  uint64_t m_size; /**< uncompressed trace size */
+  uint64_t m_position; /**< read position */
+  std::vector<block_trace_index_s> m_index; /**< block index */
+  int64_t m_loaded_block; /**< block currently in m_data (-1: none) */
+  std::vector<char> m_data; /**< inflated block */
+  std::vector<char> m_compressed; /**< compressed block buffer */
+  bool m_is_delta; /**< blocks are delta-encoded */
+  delta_trace_codec_c m_codec; /**< delta decoder */
+  std::vector<char> m_encoded; /**< inflated, still delta-encoded block */
+  std::string m_error; /**< last error message */
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Block trace writer
+///////////////////////////////////////////////////////////////////////////////////////////////
+class block_trace_writer_c
+{
+public:
+  /**
+   * Constructor
+   */
+  block_trace_writer_c();
+
+  /**
+   * Destructor
+   */
+  ~block_trace_writer_c();
+
+  /**
+   * Create a block trace with block_size uncompressed bytes per block. With a codec, records
+   * are delta-encoded (block_size must be a multiple of the codec record size).
+   */
+  bool open(const std::string& filename, uint32_t block_size,
+            const delta_trace_codec_c* codec = NULL);
+
+  /**
+   * Append len bytes
+   */
+  bool write(const void* buf, unsigned len);
+
+  /**
+   * Flush the last block and write the index
+   */
+  bool close(void);
+
+private:
+  /**
+   * Compress and write the pending block
+   */
+  bool flush_block(void);
+
+  FILE* m_file; /**< trace file */
+  uint32_t m_block_size; /**< uncompressed bytes per block */
+  uint64_t m_offset; /**< current file offset */
+  uint64_t m_size; /**< uncompressed bytes written */
+  std::vector<block_trace_index_s> m_index; /**< block index */
+  std::vector<char> m_data; /**< pending (uncompressed) block */
+  std::vector<char> m_compressed; /**< compressed block buffer */
+  bool m_is_delta; /**< blocks are delta-encoded */
+  delta_trace_codec_c m_codec; /**< delta encoder */
+  std::vector<char> m_encoded; /**< delta-encoded block */
+  uint32_t m_version; /**< format version */
+};
+
+#endif  // BLOCK_TRACE_H_INCLUDED
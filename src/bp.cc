@@ -88,6 +88,7 @@ bp_data_c::~bp_data_c() {
 // bp_dir_base_c constructor
 bp_dir_base_c::bp_dir_base_c(macsim_c* simBase) {
   m_simBase = simBase;
+  m_knob_values = simBase->m_knob_values;
   m_global_hist = 0;
   m_global_hist_64 = 0;
 }
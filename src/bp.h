@@ -119,6 +119,7 @@ public:
 
 protected:
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  const all_knob_values_s* m_knob_values; /**< knob snapshot for hot paths */
 
 private:
   /**
@@ -70,9 +70,9 @@ uns8 bp_gshare_c::pred(uop_c *uop) {
   Addr addr = uop->m_pc;
   uns32 hist = m_global_hist;
   uns32 cooked_hist =
-    COOK_HIST_BITS(hist, *m_simBase->m_knobs->KNOB_BP_HIST_LENGTH, 0);
+    COOK_HIST_BITS(hist, KNOB_VALUE(KNOB_BP_HIST_LENGTH), 0);
   uns32 cooked_addr =
-    COOK_ADDR_BITS(addr, *m_simBase->m_knobs->KNOB_BP_HIST_LENGTH, 2);
+    COOK_ADDR_BITS(addr, KNOB_VALUE(KNOB_BP_HIST_LENGTH), 2);
   uns32 pht_index = cooked_hist ^ cooked_addr;
   uns8 pht_entry = m_pht[pht_index];
   // uns8  pred        = ((pht_entry >> (*KNOB(KNOB_PHT_CTR_BITS)) - 1)) & 0x1;
@@ -97,9 +97,9 @@ void bp_gshare_c::update(uop_c *uop) {
   Addr addr = uop->m_pc;
   uns32 hist = uop->m_uop_info.m_pred_global_hist;
   uns32 cooked_hist =
-    COOK_HIST_BITS(hist, *m_simBase->m_knobs->KNOB_BP_HIST_LENGTH, 0);
+    COOK_HIST_BITS(hist, KNOB_VALUE(KNOB_BP_HIST_LENGTH), 0);
   uns32 cooked_addr =
-    COOK_ADDR_BITS(addr, *m_simBase->m_knobs->KNOB_BP_HIST_LENGTH, 2);
+    COOK_ADDR_BITS(addr, KNOB_VALUE(KNOB_BP_HIST_LENGTH), 2);
   uns32 pht_index = cooked_hist ^ cooked_addr;
   uns8 pht_entry = m_pht[pht_index];
 
@@ -107,11 +107,11 @@ void bp_gshare_c::update(uop_c *uop) {
     "Writing gshare PHT for  op_num:%llu  index:%d  dir:%d ent:%u max value is "
     ":%lld \n",
     uop->m_uop_num, pht_index, uop->m_dir, m_pht[pht_index],
-    N_BIT_MASK(*m_simBase->m_knobs->KNOB_PHT_CTR_BITS));
+    N_BIT_MASK(KNOB_VALUE(KNOB_PHT_CTR_BITS)));
 
   if (uop->m_dir) {
     m_pht[pht_index] =
-      SAT_INC(pht_entry, N_BIT_MASK(*m_simBase->m_knobs->KNOB_PHT_CTR_BITS));
+      SAT_INC(pht_entry, N_BIT_MASK(KNOB_VALUE(KNOB_PHT_CTR_BITS)));
   } else {
     m_pht[pht_index] = SAT_DEC(pht_entry, 0);
   }
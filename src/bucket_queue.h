@@ -0,0 +1,213 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : bucket_queue.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Latency bucket array backing pqueue_c
+ *********************************************************************************************/
+
+/*
+ * Summary: Storage of the latency/priority queue
+ *
+ *   There are latency+1 buckets. Each bucket is a fixed-size ring buffer large enough to
+ *   hold every entry of the queue, kept sorted by priority (highest first, FIFO among
+ *   equal priorities). New entries go to the last bucket and are dequeued from the
+ *   current bucket. Since almost all entries have the same priority, an enqueue normally
+ *   appends without moving anything.
+ *
+ *   This class has no dependency on the simulator so that it can be checked standalone
+ *   (tools/pqueue_check). Capacity checks are done by pqueue_c.
+ */
+
+#ifndef BUCKET_QUEUE_H_INCLUDED
+#define BUCKET_QUEUE_H_INCLUDED
+
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Array of ring buffers, one per latency slot
+///////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+class bucket_queue_c
+{
+  /**
+   * queue entry
+   */
+  typedef struct bucket_entry_s {
+    int64_t m_priority; /**< entry priority */
+    T m_data; /**< entry data */
+  } bucket_entry_s;
+
+public:
+  /**
+   * Constructor
+   * @param capacity maximum number of entries
+   * @param latency modeled latency (latency + 1 buckets)
+   */
+  bucket_queue_c(int capacity, int latency) {
+    m_size = latency + 1;
+    m_bucket_size = 1;
+    while (m_bucket_size < capacity) m_bucket_size <<= 1;
+    m_mask = m_bucket_size - 1;
+
+    m_entry = new bucket_entry_s[m_size * m_bucket_size];
+    m_head = new int[m_size];
+    m_count = new int[m_size];
+
+    flush();
+  }
+
+  /**
+   * Destructor
+   */
+  ~bucket_queue_c() {
+    delete[] m_entry;
+    delete[] m_head;
+    delete[] m_count;
+  }
+
+  /**
+   * Check ready entry
+   */
+  bool ready() {
+    return m_count[m_current_index] != 0;
+  }
+
+  /**
+   * Insert a new entry behind all entries of the same or higher priority
+   */
+  void enqueue(int64_t priority, const T& data) {
+    int bucket = m_last_index;
+    int pos = m_count[bucket];
+    while (pos > 0 && at(bucket, pos - 1).m_priority < priority) {
+      at(bucket, pos) = at(bucket, pos - 1);
+      --pos;
+    }
+
+    bucket_entry_s& entry = at(bucket, pos);
+    entry.m_priority = priority;
+    entry.m_data = data;
+
+    ++m_count[bucket];
+    ++m_num_entry;
+  }
+
+  /**
+   * Dequeue the first entry of the current bucket
+   */
+  T dequeue(int64_t* priority) {
+    int bucket = m_current_index;
+    bucket_entry_s& entry = at(bucket, 0);
+    if (priority) *priority = entry.m_priority;
+
+    m_head[bucket] = (m_head[bucket] + 1) & m_mask;
+    --m_count[bucket];
+    --m_num_entry;
+
+    return entry.m_data;
+  }
+
+  /**
+   * Advance queues (aging)
+   */
+  void advance() {
+    if (settled()) return;
+
+    m_last_index = m_current_index;
+    m_current_index = (m_current_index + 1) % m_size;
+  }
+
+  /**
+   * Check whether advance() would leave the queue unchanged
+   */
+  bool settled() {
+    return m_num_entry == 0 || m_count[m_current_index] != 0;
+  }
+
+  /**
+   * Search N-th priority entry (T(0) if there is none)
+   */
+  T peek(int entry) {
+    for (int ii = 0; ii < m_size; ++ii) {
+      int bucket = (m_current_index + ii) % m_size;
+      if (entry < m_count[bucket]) return at(bucket, entry).m_data;
+      entry -= m_count[bucket];
+    }
+
+    return T(0);
+  }
+
+  /**
+   * Return the number of entries
+   */
+  int size() {
+    return m_num_entry;
+  }
+
+  /**
+   * Remove all entries
+   */
+  void flush() {
+    for (int ii = 0; ii < m_size; ++ii) {
+      m_head[ii] = 0;
+      m_count[ii] = 0;
+    }
+
+    m_num_entry = 0;
+    m_current_index = 0;
+    m_last_index = m_size - 1;
+  }
+
+private:
+  bucket_queue_c();  // do not implement
+  bucket_queue_c(const bucket_queue_c& rhs);  // do not implement
+  const bucket_queue_c& operator=(const bucket_queue_c& rhs);  // do not implement
+
+  /**
+   * N-th entry of a bucket
+   */
+  bucket_entry_s& at(int bucket, int pos) {
+    return m_entry[bucket * m_bucket_size + ((m_head[bucket] + pos) & m_mask)];
+  }
+
+  bucket_entry_s* m_entry; /**< ring buffers of all buckets */
+  int* m_head; /**< first entry of each bucket */
+  int* m_count; /**< number of entries in each bucket */
+  int m_size; /**< number of buckets */
+  int m_bucket_size; /**< ring buffer size (power of 2) */
+  int m_mask; /**< ring buffer index mask */
+  int m_num_entry; /**< current queue entries */
+  int m_last_index; /**< last bucket index */
+  int m_current_index; /**< current bucket index */
+};
+
+#endif  // BUCKET_QUEUE_H_INCLUDED
@@ -130,7 +130,6 @@ void bug_detector_c::print(int core_id, int thread_id) {
   ofstream out("bug_detect_uop.out");
   for (int ii = 0; ii < m_num_core; ++ii) {
     core_c* core = m_simBase->m_core_pointers[ii];
-    string core_type = core->get_core_type();
 
     unsigned int average_latency = 0;
     if (m_latency_count[ii] > 0)
@@ -169,7 +168,7 @@ void bug_detector_c::print(int core_id, int thread_id) {
           << left << (*m_uop_table[ii])[(*I)] << setw(15) << left
           << CYCLE - (*m_uop_table[ii])[(*I)] << setw(25) << left
           << uop_c::g_uop_state_name[uop->m_state] << setw(25) << left
-          << ((core_type == "ptx") || (core_type == "nvbit")
+          << (core->is_nvidia_core()
                 ? gpu_decoder_c::g_tr_opcode_names[uop->m_opcode]
                 : cpu_decoder_c::g_tr_opcode_names[uop->m_opcode])
           << setw(20) << left << uop_c::g_uop_type_name[uop->m_uop_type]
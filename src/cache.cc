@@ -38,12 +38,17 @@ POSSIBILITY OF SUCH DAMAGE.
  * Summary: Cache library
  */
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 #include "assert_macros.h"
 #include "cache.h"
 #include "utils.h"
 
 #include "debug_macros.h"
 
+#include "checkpoint.h"
 #include "all_knobs.h"
 
 #define DEBUG(args...) _DEBUG(*m_simBase->m_knobs->KNOB_DEBUG_CACHE_LIB, ##args)
@@ -58,10 +63,43 @@ cache_entry_c::cache_entry_c() : m_valid(false), m_last_access_time(0) {
 cache_set_c::cache_set_c(int assoc) {
   m_entry = new cache_entry_c[assoc];
   m_assoc = assoc;
+
+  m_num_tag_slots = (assoc + 3) & ~3;
+  m_tag = new Addr[m_num_tag_slots];
+  for (int ii = 0; ii < m_num_tag_slots; ++ii) m_tag[ii] = CACHE_INVALID_TAG;
 }
 
 cache_set_c::~cache_set_c() {
   delete[] m_entry;
+  delete[] m_tag;
+}
+
+// first slot of a tag array (size multiple of 4) equal to tag, -1 if none
+static inline int find_tag_slot(const Addr *tags, int num_slots, Addr tag) {
+#if defined(__AVX2__)
+  const __m256i key = _mm256_set1_epi64x((long long)tag);
+  for (int ii = 0; ii < num_slots; ii += 4) {
+    __m256i eq = _mm256_cmpeq_epi64(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(tags + ii)), key);
+    int mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq));
+    if (mask) return ii + __builtin_ctz(mask);
+  }
+#elif defined(__SSE2__)
+  // SSE2 has no 64-bit compare: both 32-bit halves must match
+  const __m128i key = _mm_set1_epi64x((long long)tag);
+  for (int ii = 0; ii < num_slots; ii += 2) {
+    __m128i eq = _mm_cmpeq_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(tags + ii)), key);
+    eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+    int mask = _mm_movemask_pd(_mm_castsi128_pd(eq));
+    if (mask) return ii + __builtin_ctz(mask);
+  }
+#else
+  for (int ii = 0; ii < num_slots; ++ii) {
+    if (tags[ii] == tag) return ii;
+  }
+#endif
+  return -1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -198,26 +236,23 @@ void *cache_c::access_cache(Addr addr, Addr *line_addr, bool update_repl,
 
   if (update_repl) update_cache_on_access(*line_addr, set, appl_id);
 
-  // Walk through the set
-  for (int ii = 0; ii < m_assoc; ++ii) {
-    // For each line in based on associativity
-    cache_entry_c *line = &(m_set[set]->m_entry[ii]);
+  // Search the tags of the set
+  int way = find_way(set, tag);
+  if (way != -1) {
+    cache_entry_c *line = &(m_set[set]->m_entry[way]);
 
-    // Check for matching tag and validity
-    if (line->m_valid && line->m_tag == tag) {
-      // If hit, then return
-      assert(line->m_data);
+    // If hit, then return
+    assert(line->m_data);
 
-      if (update_repl) {
-        // If prefetch is set mark it as used
-        if (line->m_pref) {
-          line->m_pref = false;
-        }
-        update_line_on_hit(line, set, appl_id);
+    if (update_repl) {
+      // If prefetch is set mark it as used
+      if (line->m_pref) {
+        line->m_pref = false;
       }
-
-      return line->m_data;
+      update_line_on_hit(line, set, appl_id);
     }
+
+    return line->m_data;
   }
 
   if (update_repl) update_cache_on_miss(set, appl_id);
@@ -324,6 +359,7 @@ void cache_c::initialize_cache_line(cache_entry_c *ins_line, Addr tag,
                                     int set_id, bool skip) {
   ins_line->m_valid = true;
   ins_line->m_tag = tag;
+  m_set[set_id]->m_tag[ins_line - m_set[set_id]->m_entry] = tag;
   ins_line->m_base = (addr & ~m_offset_mask);
   ins_line->m_access_counter = 0;
   ins_line->m_last_access_time = CYCLE;
@@ -403,7 +439,10 @@ void cache_c::update_set_on_replacement(Addr tag, int appl_id, int set,
 }
 
 // initialize (nullify) a cache line
-bool cache_c::null_cache_line_fields(cache_entry_c *line) {
+bool cache_c::null_cache_line_fields(int set, int way) {
+  cache_entry_c *line = &(m_set[set]->m_entry[way]);
+  m_set[set]->m_tag[way] = CACHE_INVALID_TAG;
+
   line->m_tag = 0;
   line->m_valid = false;
   line->m_base = 0;
@@ -424,15 +463,10 @@ bool cache_c::invalidate_cache_line(Addr addr) {
   // to the new cache line being returned
   find_tag_and_set(addr, &tag, &set);
 
-  for (int ii = 0; ii < m_assoc; ++ii) {
-    // For each line in based on associativity
-    cache_entry_c *line = &(m_set[set]->m_entry[ii]);
-
-    // Check for matching tag and validity
-    if (line->m_valid && line->m_tag == tag) {
-      // If hit, then erase the current line data and return
-      return null_cache_line_fields(line);
-    }
+  int way = find_way(set, tag);
+  if (way != -1) {
+    // If hit, then erase the current line data and return
+    return null_cache_line_fields(set, way);
   }
 
   return false;
@@ -450,6 +484,7 @@ void cache_c::invalidate_cache(void) {
       cache_entry_c *line = &(m_set[ii]->m_entry[jj]);
       line->m_valid = false;
       line->m_tag = 0;
+      m_set[ii]->m_tag[jj] = CACHE_INVALID_TAG;
       memset(line->m_data, 0, m_data_size);
     }
   }
@@ -494,6 +529,23 @@ Counter cache_c::find_min_lru(int set) {
   return lru_time;
 }
 
+// find the first valid way with the tag
+int cache_c::find_way(int set, Addr tag) {
+  cache_set_c *cache_set = m_set[set];
+  int way = find_tag_slot(cache_set->m_tag, cache_set->m_num_tag_slots, tag);
+  if (likely(way == -1 || (way < m_assoc && cache_set->m_entry[way].m_valid))) {
+    return way;
+  }
+
+  // tag == CACHE_INVALID_TAG; invalid ways match too
+  for (int ii = 0; ii < m_assoc; ++ii) {
+    cache_entry_c *line = &(cache_set->m_entry[ii]);
+    if (line->m_valid && line->m_tag == tag) return ii;
+  }
+
+  return -1;
+}
+
 // print cache information
 void cache_c::print_info(int id) {
   if (*m_simBase->m_knobs->KNOB_COLLECT_CACHE_INFO > 0 &&
@@ -502,3 +554,70 @@ void cache_c::print_info(int id) {
          << " gpu: " << m_num_gpu_line << "\n";
   }
 }
+
+// save all cache lines
+void cache_c::save_checkpoint(checkpoint_c *ckpt) {
+  ckpt->write(m_num_sets);
+  ckpt->write(m_assoc);
+  ckpt->write(m_line_size);
+  ckpt->write(m_data_size);
+
+  ckpt->write(m_num_cpu_line);
+  ckpt->write(m_num_gpu_line);
+  ckpt->write(m_insert_count);
+
+  for (int ii = 0; ii < m_num_sets; ++ii) {
+    cache_set_c *set = m_set[ii];
+    ckpt->write(set->m_num_cpu_line);
+    ckpt->write(set->m_num_gpu_line);
+
+    for (int jj = 0; jj < m_assoc; ++jj) {
+      cache_entry_c *line = &set->m_entry[jj];
+      ckpt->write(line->m_valid);
+      ckpt->write(line->m_tag);
+      ckpt->write(line->m_base);
+      ckpt->write(line->m_last_access_time);
+      ckpt->write(line->m_access_counter);
+      ckpt->write(line->m_pref);
+      ckpt->write(line->m_dirty);
+      ckpt->write(line->m_appl_id);
+      ckpt->write(line->m_gpuline);
+      ckpt->write(line->m_skip);
+      if (m_data_size > 0) ckpt->write_bytes(line->m_data, m_data_size);
+    }
+  }
+}
+
+// load all cache lines
+void cache_c::restore_checkpoint(checkpoint_c *ckpt) {
+  ckpt->check(m_num_sets, "number of cache sets");
+  ckpt->check(m_assoc, "cache associativity");
+  ckpt->check(m_line_size, "cache line size");
+  ckpt->check(m_data_size, "cache data size");
+
+  m_num_cpu_line = ckpt->read<int>();
+  m_num_gpu_line = ckpt->read<int>();
+  m_insert_count = ckpt->read<Counter>();
+
+  for (int ii = 0; ii < m_num_sets; ++ii) {
+    cache_set_c *set = m_set[ii];
+    set->m_num_cpu_line = ckpt->read<int>();
+    set->m_num_gpu_line = ckpt->read<int>();
+
+    for (int jj = 0; jj < m_assoc; ++jj) {
+      cache_entry_c *line = &set->m_entry[jj];
+      line->m_valid = ckpt->read<bool>();
+      line->m_tag = ckpt->read<Addr>();
+      line->m_base = ckpt->read<Addr>();
+      line->m_last_access_time = ckpt->read<Counter>();
+      line->m_access_counter = ckpt->read<Counter>();
+      line->m_pref = ckpt->read<bool>();
+      line->m_dirty = ckpt->read<bool>();
+      line->m_appl_id = ckpt->read<int>();
+      line->m_gpuline = ckpt->read<bool>();
+      line->m_skip = ckpt->read<bool>();
+      if (m_data_size > 0) ckpt->read_bytes(line->m_data, m_data_size);
+      set->m_tag[jj] = line->m_valid ? line->m_tag : CACHE_INVALID_TAG;
+    }
+  }
+}
@@ -58,6 +58,10 @@ typedef enum Cache_Type_enum {
 /* set data pointers to this initially */
 #define INIT_CACHE_DATA_VALUE ((void *)0x8badbeef)
 
+/* tag of invalid ways in the per-set tag array; find_tag_and_set only generates it for a
+   single-set cache with 1B lines, and lookups still check the valid bit */
+#define CACHE_INVALID_TAG (~(Addr)0)
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief Cache entry class
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,6 +86,10 @@ public:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief Cache set class
+///
+/// Tags of the set are also kept in a contiguous array (CACHE_INVALID_TAG for invalid ways)
+/// so that a lookup compares several ways at once; cache entries hold the rest of the line
+/// state (replacement, ownership, data). The tag array is padded to a multiple of 4 ways.
 ///////////////////////////////////////////////////////////////////////////////////////////////
 class cache_set_c
 {
@@ -100,6 +108,8 @@ public:
 
 public:
   cache_entry_c *m_entry; /**< cache entries */
+  Addr *m_tag; /**< tag of each way, CACHE_INVALID_TAG if invalid */
+  int m_num_tag_slots; /**< tag array size (assoc rounded up to 4) */
   int m_assoc; /**< associativity */
   int m_num_cpu_line; /**< number of cpu cache line */
   int m_num_gpu_line; /**< number of gpu cache line */
@@ -251,10 +261,11 @@ public:
   /**
    * \brief Function to null out all fields in the caache line
       being invalidated
-   * \param line - Cache line being invalidated
+   * \param set - Set of the cache line being invalidated
+   * \param way - Way of the cache line being invalidated
    * \return bool - Dirty flag
    */
-  bool null_cache_line_fields(cache_entry_c *line);
+  bool null_cache_line_fields(int set, int way);
 
   /**
    * \brief Function to invalidate cache line.
@@ -296,6 +307,26 @@ public:
    */
   void print_info(int id);
 
+  /**
+   * \brief Find the first valid way of a set with the given tag.
+   * \param set - set id
+   * \param tag - tag
+   * \return int - way, -1 if not found
+   */
+  int find_way(int set, Addr tag);
+
+  /**
+   * \brief Save all cache lines (tags, replacement state and line data).
+   * \param ckpt - checkpoint
+   */
+  void save_checkpoint(checkpoint_c *ckpt);
+
+  /**
+   * \brief Load all cache lines; the cache geometry must match the checkpoint.
+   * \param ckpt - checkpoint
+   */
+  void restore_checkpoint(checkpoint_c *ckpt);
+
 public:
   Cache_Type m_cache_type; /**< cache type */
 
@@ -0,0 +1,312 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : checkpoint.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Warm-state checkpoint and restore
+ *********************************************************************************************/
+
+#include <sstream>
+#include <vector>
+
+#include "checkpoint.h"
+#include "assert_macros.h"
+#include "core.h"
+#include "debug_macros.h"
+#include "dram.h"
+#include "macsim.h"
+#include "memory.h"
+#include "mmu.h"
+#include "process_manager.h"
+#include "retire.h"
+
+#include "all_knobs.h"
+#include "statistics.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// checkpoint_c constructor
+checkpoint_c::checkpoint_c(macsim_c* simBase) {
+  m_simBase = simBase;
+  m_file = NULL;
+  m_next_save = *KNOB(KNOB_CHECKPOINT_SAVE_CYCLE);
+  m_restored = false;
+
+  if (m_next_save ||
+      KNOB(KNOB_CHECKPOINT_RESTORE_FILE)->getValue() != "none") {
+    // these features keep state outside of the components that are saved
+    ASSERTM(!*KNOB(KNOB_ENABLE_HMC_INST) && !*KNOB(KNOB_ENABLE_HMC_TRANS) &&
+              !*KNOB(KNOB_ENABLE_HMC_INST_SKIP) && !*KNOB(KNOB_ENABLE_LOCK_SKIP),
+            "checkpoints do not support hmc instructions or lock skipping\n");
+    ASSERTM(!*KNOB(KNOB_REPEAT_TRACE),
+            "checkpoints do not support repeated traces\n");
+    ASSERTM(!*KNOB(KNOB_ENABLE_DYFR),
+            "checkpoints do not support dynamic frequency scaling\n");
+    ASSERTM(!*KNOB(KNOB_ENABLE_PHYSICAL_MAPPING),
+            "checkpoints do not support physical page mapping\n");
+  }
+}
+
+// checkpoint_c destructor
+checkpoint_c::~checkpoint_c() {
+  if (m_file) fclose(m_file);
+}
+
+void checkpoint_c::write_bytes(const void* buf, size_t size) {
+  if (size && fwrite(buf, size, 1, m_file) != 1)
+    ASSERTM(0, "error writing checkpoint %s\n", m_file_name.c_str());
+}
+
+void checkpoint_c::read_bytes(void* buf, size_t size) {
+  if (size && fread(buf, size, 1, m_file) != 1)
+    ASSERTM(0, "error reading checkpoint %s\n", m_file_name.c_str());
+}
+
+void checkpoint_c::mismatch(const char* what) {
+  ASSERTM(0, "checkpoint %s was saved with a different %s\n",
+          m_file_name.c_str(), what);
+}
+
+// a terminated thread replays its last instruction so that it ends the same way it did
+// before the checkpoint (trace end or KNOB_MAX_INSTS)
+Counter checkpoint_c::trace_skip(Counter num_retired, bool ended) {
+  if (ended && num_retired > 0) return num_retired - 1;
+  return num_retired;
+}
+
+bool checkpoint_c::save_due(void) {
+  return m_next_save && m_simBase->m_simulation_cycle >= m_next_save;
+}
+
+// write a checkpoint of the current state
+void checkpoint_c::save(void) {
+  stringstream sstr;
+  sstr << KNOB(KNOB_STATISTICS_OUT_DIRECTORY)->getValue() << "/"
+       << KNOB(KNOB_CHECKPOINT_FILE)->getValue() << "."
+       << m_simBase->m_simulation_cycle;
+  m_file_name = sstr.str();
+
+  m_file = fopen(m_file_name.c_str(), "wb");
+  if (m_file == NULL)
+    ASSERTM(0, "cannot create checkpoint %s\n", m_file_name.c_str());
+
+  int num_cores = *KNOB(KNOB_NUM_SIM_CORES);
+
+  // header
+  write<uint32_t>(CHECKPOINT_MAGIC);
+  write<uint32_t>(CHECKPOINT_VERSION);
+  write<int>(num_cores);
+  write<int>(m_simBase->m_num_mc);
+
+  // clock
+  write<Counter>(m_simBase->m_simulation_cycle);
+
+  // components
+  for (int ii = 0; ii < num_cores; ++ii)
+    m_simBase->m_core_pointers[ii]->save_checkpoint(this);
+  m_simBase->m_memory->save_checkpoint(this);
+  for (int ii = 0; ii < m_simBase->m_num_mc; ++ii)
+    m_simBase->m_dram_controller[ii]->save_checkpoint(this);
+  m_simBase->m_MMU->save_checkpoint(this);
+
+  // trace positions of x86 threads : terminated and running threads
+  map<pair<int, int>, Counter> threads;
+  for (auto I = m_ended_threads.begin(), E = m_ended_threads.end(); I != E; ++I)
+    threads[I->first] = trace_skip(I->second, true);
+
+  for (int ii = 0; ii < num_cores; ++ii) {
+    core_c* core = m_simBase->m_core_pointers[ii];
+    for (int tid = 0; tid < core->m_unique_scheduled_thread_num; ++tid) {
+      if (core->m_thread_finished[tid]) continue;
+
+      thread_s* thread = core->get_trace_info(tid);
+      if (thread->m_acc) continue;
+
+      threads[make_pair(thread->m_process->m_orig_pid,
+                        thread->m_unique_thread_id)] =
+        trace_skip(core->get_retire()->get_instrs_retired(tid), false);
+    }
+  }
+
+  write<uint64_t>(threads.size());
+  for (auto I = threads.begin(), E = threads.end(); I != E; ++I) {
+    write<int>(I->first.first);
+    write<int>(I->first.second);
+    write<Counter>(I->second);
+  }
+
+  // a GPU kernel that is in flight is restarted on restore, so the stats go back to the
+  // start of that kernel. Stats of other applications cannot be separated from it.
+  int num_running = 0;
+  bool gpu_running = false;
+  for (auto I = m_simBase->m_sim_processes.begin(),
+            E = m_simBase->m_sim_processes.end();
+       I != E; ++I) {
+    process_s* process = I->second;
+    if (process->m_no_of_threads_terminated == process->m_no_of_threads_created)
+      continue;
+    ++num_running;
+    if (process->m_acc) gpu_running = true;
+  }
+  ASSERTM(!gpu_running || num_running == 1,
+          "cycle %llu: checkpoints cannot be taken while a GPU kernel runs alongside "
+          "other applications\n",
+          (unsigned long long)m_simBase->m_simulation_cycle);
+
+  // current kernel of each application
+  write<uint64_t>(m_simBase->m_sim_processes.size());
+  for (auto I = m_simBase->m_sim_processes.begin(),
+            E = m_simBase->m_sim_processes.end();
+       I != E; ++I) {
+    process_s* process = I->second;
+    unsigned kernel = process->m_current_vector_index - 1;
+    write<int>(I->first);
+    write<unsigned>(kernel);
+    write<int>(process->m_kernel_block_start_count[kernel]);
+  }
+
+  // stats
+  vector<unsigned long long> counts;
+  if (gpu_running)
+    counts = m_kernel_start_stats;
+  else
+    m_simBase->m_ProcessorStats->getCounts(&counts);
+  write<uint64_t>(counts.size());
+  write_bytes(counts.data(), counts.size() * sizeof(unsigned long long));
+
+  fclose(m_file);
+  m_file = NULL;
+
+  report("checkpoint saved to " << m_file_name);
+
+  if (*KNOB(KNOB_CHECKPOINT_INTERVAL))
+    m_next_save = m_simBase->m_simulation_cycle + *KNOB(KNOB_CHECKPOINT_INTERVAL);
+  else
+    m_next_save = 0;
+}
+
+// restore the state saved in KNOB_CHECKPOINT_RESTORE_FILE
+void checkpoint_c::restore(void) {
+  m_file_name = KNOB(KNOB_CHECKPOINT_RESTORE_FILE)->getValue();
+  if (m_file_name == "none") return;
+
+  m_file = fopen(m_file_name.c_str(), "rb");
+  if (m_file == NULL)
+    ASSERTM(0, "cannot open checkpoint %s\n", m_file_name.c_str());
+
+  int num_cores = *KNOB(KNOB_NUM_SIM_CORES);
+
+  // header
+  check<uint32_t>(CHECKPOINT_MAGIC, "file format");
+  check<uint32_t>(CHECKPOINT_VERSION, "file version");
+  check<int>(num_cores, "number of cores");
+  check<int>(m_simBase->m_num_mc, "number of memory controllers");
+
+  // clock : move every clock domain to the checkpoint cycle
+  Counter cycle = read<Counter>();
+  m_simBase->advance_clock_windows(cycle / m_simBase->m_clock_lcm);
+
+  // components
+  for (int ii = 0; ii < num_cores; ++ii)
+    m_simBase->m_core_pointers[ii]->restore_checkpoint(this);
+  m_simBase->m_memory->restore_checkpoint(this);
+  for (int ii = 0; ii < m_simBase->m_num_mc; ++ii)
+    m_simBase->m_dram_controller[ii]->restore_checkpoint(this);
+  m_simBase->m_MMU->restore_checkpoint(this);
+
+  // trace positions : applied when each thread is set up
+  uint64_t num_threads = read<uint64_t>();
+  for (uint64_t ii = 0; ii < num_threads; ++ii) {
+    int pid = read<int>();
+    int tid = read<int>();
+    m_trace_skip[make_pair(pid, tid)] = read<Counter>();
+  }
+
+  // current kernels : applied when each application is created
+  uint64_t num_processes = read<uint64_t>();
+  for (uint64_t ii = 0; ii < num_processes; ++ii) {
+    int pid = read<int>();
+    unsigned kernel = read<unsigned>();
+    m_kernel[pid] = make_pair(kernel, read<int>());
+  }
+
+  // stats
+  vector<unsigned long long> counts;
+  m_simBase->m_ProcessorStats->getCounts(&counts);
+  check<uint64_t>(counts.size(), "set of stats");
+  read_bytes(counts.data(), counts.size() * sizeof(unsigned long long));
+  m_simBase->m_ProcessorStats->setCounts(counts);
+
+  fclose(m_file);
+  m_file = NULL;
+
+  m_restored = true;
+  report("restored checkpoint " << m_file_name);
+}
+
+void checkpoint_c::thread_terminated(thread_s* thread, Counter num_retired) {
+  if (!m_next_save || thread->m_acc) return;
+
+  m_ended_threads[make_pair(thread->m_process->m_orig_pid,
+                            thread->m_unique_thread_id)] = num_retired;
+}
+
+Counter checkpoint_c::get_trace_skip(thread_s* thread) {
+  if (!m_restored || thread->m_acc) return 0;
+
+  auto I = m_trace_skip.find(
+    make_pair(thread->m_process->m_orig_pid, thread->m_unique_thread_id));
+  if (I == m_trace_skip.end()) return 0;
+
+  Counter skip = I->second;
+  m_trace_skip.erase(I);
+  return skip;
+}
+
+void checkpoint_c::restore_process(process_s* process) {
+  if (!m_restored) return;
+
+  auto I = m_kernel.find(process->m_orig_pid);
+  if (I == m_kernel.end()) return;
+
+  ASSERTM(I->second.first < process->m_applications.size(),
+          "checkpoint %s: application %d has no kernel %u\n",
+          m_file_name.c_str(), process->m_orig_pid, I->second.first);
+  process->m_current_vector_index = I->second.first;
+  process->m_block_count = I->second.second;
+  m_kernel.erase(I);
+}
+
+void checkpoint_c::kernel_started(process_s* process) {
+  if (!m_next_save || !process->m_acc) return;
+
+  m_simBase->m_ProcessorStats->getCounts(&m_kernel_start_stats);
+}
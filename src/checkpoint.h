@@ -0,0 +1,186 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : checkpoint.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Warm-state checkpoint and restore
+ *********************************************************************************************/
+
+#ifndef CHECKPOINT_H_INCLUDED
+#define CHECKPOINT_H_INCLUDED
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "global_defs.h"
+#include "global_types.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// Checkpoint file layout
+///
+/// header | clock | cores | memory system | dram controllers | MMU | threads | processes |
+/// stats
+///
+/// A checkpoint is taken at a clock window boundary and holds the warm state of the machine:
+/// cache and TLB contents, page table, open dram rows, statistics and the trace position of
+/// every thread. Requests that are in flight in the pipeline or in the memory system are not
+/// saved; a restored x86 thread resumes after its last retired instruction and a restored
+/// GPU application restarts the kernel that was running when the checkpoint was taken. The
+/// stats of such a checkpoint are the ones from the start of that kernel, so a GPU kernel
+/// can only be checkpointed while no other application is running.
+///////////////////////////////////////////////////////////////////////////////////////////////
+#define CHECKPOINT_MAGIC 0x504b434d  // "MCKP"
+#define CHECKPOINT_VERSION 1
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Checkpoint writer / reader
+///
+/// Components serialize themselves through write()/read() in a fixed order. Structures whose
+/// geometry depends on the configuration (caches, dram banks) store their geometry first and
+/// check it on restore, so a checkpoint can be used to fork runs that differ in other knobs.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class checkpoint_c
+{
+public:
+  /**
+   * Constructor
+   */
+  checkpoint_c(macsim_c* simBase);
+
+  /**
+   * Destructor
+   */
+  ~checkpoint_c();
+
+  /**
+   * Restore the state saved in KNOB_CHECKPOINT_RESTORE_FILE. Called before traces are opened
+   */
+  void restore(void);
+
+  /**
+   * Check whether a checkpoint is due at the current clock window boundary
+   */
+  bool save_due(void);
+
+  /**
+   * Write a checkpoint of the current state and schedule the next one
+   */
+  void save(void);
+
+  /**
+   * Record the progress of a terminated x86 thread (needed by later checkpoints)
+   */
+  void thread_terminated(thread_s* thread, Counter num_retired);
+
+  /**
+   * Number of trace records a restored thread skips when it is set up
+   */
+  Counter get_trace_skip(thread_s* thread);
+
+  /**
+   * Move a restored process to the kernel that was running at the checkpoint
+   */
+  void restore_process(process_s* process);
+
+  /**
+   * Remember the stats at the start of a GPU kernel (a restored kernel restarts from there)
+   */
+  void kernel_started(process_s* process);
+
+  /**
+   * Write raw bytes
+   */
+  void write_bytes(const void* buf, size_t size);
+
+  /**
+   * Read raw bytes
+   */
+  void read_bytes(void* buf, size_t size);
+
+  /**
+   * Write a value
+   */
+  template <typename T>
+  void write(const T& value) {
+    write_bytes(&value, sizeof(T));
+  }
+
+  /**
+   * Read a value
+   */
+  template <typename T>
+  T read(void) {
+    T value;
+    read_bytes(&value, sizeof(T));
+    return value;
+  }
+
+  /**
+   * Read a value and check that it matches the current configuration
+   */
+  template <typename T>
+  void check(const T& value, const char* what) {
+    T saved = read<T>();
+    if (saved != value) mismatch(what);
+  }
+
+private:
+  checkpoint_c();  // do not implement
+
+  /**
+   * Report a configuration mismatch and stop
+   */
+  void mismatch(const char* what);
+
+  /**
+   * Trace records to skip for a thread with num_retired retired instructions
+   */
+  static Counter trace_skip(Counter num_retired, bool ended);
+
+  macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  FILE* m_file; /**< checkpoint file being written or read */
+  std::string m_file_name; /**< name of m_file */
+  Counter m_next_save; /**< cycle of the next checkpoint (0: none) */
+  bool m_restored; /**< simulation started from a checkpoint */
+  std::map<std::pair<int, int>, Counter>
+    m_ended_threads; /**< (process, thread) -> retired insts of terminated threads */
+  std::map<std::pair<int, int>, Counter>
+    m_trace_skip; /**< (process, thread) -> trace records to skip on restore */
+  std::map<int, std::pair<unsigned, int>>
+    m_kernel; /**< process -> (kernel index, first block id) on restore */
+  std::vector<unsigned long long>
+    m_kernel_start_stats; /**< stats at the start of the running GPU kernel */
+};
+
+#endif  // CHECKPOINT_H_INCLUDED
@@ -74,6 +74,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "pqueue.h"
 #include "rob.h"
 #include "cache.h"
+#include "checkpoint.h"
 #include "statistics.h"
 #include "utils.h"
 #include "pref_common.h"
@@ -89,6 +90,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "network.h"
 #include "dram.h"
 #include "resource.h"
+#include "host_profile.h"
 
 #include "config.h"
 
@@ -139,6 +141,18 @@ void core_c::init(void) {
   m_bp_recovery_info.clear();
 }
 
+// convert a core_type knob value into the enum used on the simulation path
+Core_Type core_c::parse_core_type(const string& core_type) {
+  if (core_type == "x86") return CORE_X86;
+  if (core_type == "a64") return CORE_A64;
+  if (core_type == "ptx") return CORE_PTX;
+  if (core_type == "igpu") return CORE_IGPU;
+  if (core_type == "nvbit") return CORE_NVBIT;
+
+  ASSERTM(0, "Wrong core type %s\n", core_type.c_str());
+  return CORE_X86;
+}
+
 // core_c constructor
 core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
   // Initialization
@@ -148,9 +162,11 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
 
   // Reference to simulation base globals
   m_simBase = simBase;
+  m_knob_values = simBase->m_knob_values;
 
   // configuration
   CORE_CONFIG();
+  m_core_type_id = parse_core_type(m_core_type);
 
   // memory allocation
   // uop pool
@@ -168,7 +184,7 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
   m_icache->set_core_id(m_core_id);
 
   // reorder buffer
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type  == "nvbit") {
+  if (is_acc_core()) {
     m_rob = NULL;
     m_gpu_rob = new smc_rob_c(m_unit_type, m_core_id, m_simBase);
   } else {
@@ -182,7 +198,7 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
     (m_knob_fetch_latency + m_knob_alloc_latency), "q_frontend", m_simBase);
 
   // allocation queue
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type  == "nvbit") {
+  if (is_acc_core()) {
     m_q_iaq = NULL;
     m_gpu_q_iaq = new pqueue_c<gpu_allocq_entry_s>*[max_ALLOCQ];
   } else {
@@ -197,7 +213,7 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
   q_iaq_size[simd_ALLOCQ] = siaq_size;
 
   sstr.clear();
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type  == "nvbit") {
+  if (is_acc_core()) {
     for (int i = 0; i < max_ALLOCQ; ++i) {
       sstr << "q_iaq" << i;
       sstr >> name;
@@ -227,7 +243,7 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
     FRONTEND_INTERFACE_ARGS(), m_simBase);
 
   // allocation stage
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type == "nvbit") {
+  if (is_acc_core()) {
     m_allocate = NULL;
     m_gpu_allocate = new smc_allocate_c(m_core_id, m_q_frontend, m_gpu_q_iaq,
                                         m_uop_pool, m_gpu_rob, m_unit_type,
@@ -243,10 +259,10 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
   m_exec = new exec_c(EXEC_INTERFACE_ARGS(), m_simBase);
 
   // instruction scheduler
-  if (m_core_type == "ptx" || m_core_type == "nvbit") {
+  if (is_nvidia_core()) {
     m_schedule = new schedule_smc_c(m_core_id, m_gpu_q_iaq, m_gpu_rob, m_exec,
                                     m_unit_type, m_frontend, m_simBase);
-  } else if (m_core_type == "igpu") {
+  } else if (m_core_type_id == CORE_IGPU) {
     m_schedule = new schedule_igpu_c(m_core_id, m_gpu_q_iaq, m_gpu_rob, m_exec,
                                      m_unit_type, m_frontend, m_simBase);
   } else {
@@ -267,13 +283,13 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
   m_retire = new retire_c(RETIRE_INTERFACE_ARGS(), m_simBase);
 
   // hardware prefetcher
-  if (*m_simBase->m_knobs->KNOB_PREF_FRAMEWORK_ON && m_knob_enable_pref)
+  if (KNOB_VALUE(KNOB_PREF_FRAMEWORK_ON) && m_knob_enable_pref)
     m_hw_pref = new hwp_common_c(c_id, type, m_simBase);
   else
     m_hw_pref = NULL;
 
   // const / texture cache
-  if ((m_core_type == "ptx" || m_core_type == "nvbit") &&
+  if (is_nvidia_core() &&
       *m_simBase->m_knobs->KNOB_USE_CONST_AND_TEX_CACHES) {
     m_const_cache = new readonly_cache_c(
       "const_cache", m_core_id, *KNOB(KNOB_CONST_CACHE_SIZE),
@@ -292,7 +308,7 @@ core_c::core_c(int c_id, macsim_c* simBase, Unit_Type type) {
   }
 
   // shared memory
-  if ((m_core_type == "ptx") || (m_core_type == "nvbit")) {
+  if (is_nvidia_core()) {
     m_shared_memory = new sw_managed_cache_c(
       "shared_memory", m_core_id, *KNOB(KNOB_SHARED_MEM_SIZE),
       *KNOB(KNOB_SHARED_MEM_ASSOC), *KNOB(KNOB_SHARED_MEM_LINE_SIZE),
@@ -312,8 +328,9 @@ core_c::~core_c() {
   // deallocate memories
   delete m_q_frontend;
   delete m_frontend;
+  STAT_CORE_EVENT_N(m_core_id, POOL_UOP_MAX_IN_USE, m_uop_pool->get_max_in_use());
   delete m_uop_pool;
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type == "nvbit") {
+  if (is_acc_core()) {
     delete m_gpu_rob;
     delete m_gpu_allocate;
     for (int i = 0; i < max_ALLOCQ; ++i) {
@@ -382,8 +399,8 @@ void core_c::run_a_cycle(bool pll_lock) {
   start();
 
   // to simulate kernel invocation from host code
-  if (*KNOB(KNOB_ENABLE_CONDITIONAL_EXECUTION)) {
-    if ((m_core_type == "ptx" || m_core_type == "nvbit") && m_simBase->m_gpu_paused) {
+  if (KNOB_VALUE(KNOB_ENABLE_CONDITIONAL_EXECUTION)) {
+    if (is_nvidia_core() && m_simBase->m_gpu_paused) {
       m_frontend->stop();
     }
   }
@@ -391,37 +408,100 @@ void core_c::run_a_cycle(bool pll_lock) {
   // run each pipeline stages in backwards
 
   // execution stage
-  m_exec->run_a_cycle();
+  {
+    HOST_PROF_SCOPE(HOST_PROF_EXEC);
+    m_exec->run_a_cycle();
+  }
 
   // retire stage
-  m_retire->run_a_cycle();
+  {
+    HOST_PROF_SCOPE(HOST_PROF_RETIRE);
+    m_retire->run_a_cycle();
+  }
 
   // prefetcher
-  if (*m_simBase->m_knobs->KNOB_PREF_FRAMEWORK_ON && m_knob_enable_pref)
+  if (KNOB_VALUE(KNOB_PREF_FRAMEWORK_ON) && m_knob_enable_pref) {
+    HOST_PROF_SCOPE(HOST_PROF_PREF);
     m_hw_pref->pref_update_queues();
+  }
 
   // scheduler
-  m_schedule->run_a_cycle();
+  {
+    HOST_PROF_SCOPE(HOST_PROF_SCHEDULE);
+    m_schedule->run_a_cycle();
+  }
 
   // allocate stage
-  if (m_allocate)
-    m_allocate->run_a_cycle();
-  else
-    m_gpu_allocate->run_a_cycle();
+  {
+    HOST_PROF_SCOPE(HOST_PROF_ALLOCATE);
+    if (m_allocate)
+      m_allocate->run_a_cycle();
+    else
+      m_gpu_allocate->run_a_cycle();
+  }
 
   // frontend stage
-  m_frontend->run_a_cycle();
+  {
+    HOST_PROF_SCOPE(HOST_PROF_FRONTEND);
+    m_frontend->run_a_cycle();
+  }
 
   ++m_cycle;
 }
 
+// a core is idle when every pipeline stage waits for a timer or for the
+// memory system. only out-of-order x86 cores without a hardware prefetcher
+// are modeled; others stay busy
+Counter core_c::get_idle_cycles(void) {
+  if (is_acc_core() || m_hw_pref) return 0;
+
+  // queues still have entries to age
+  if (!m_q_frontend->settled()) return 0;
+  for (int i = 0; i < max_ALLOCQ; ++i) {
+    if (!m_q_iaq[i]->settled()) return 0;
+  }
+
+  Counter idle_cycles = m_retire->get_idle_cycles();
+  if (idle_cycles == 0) return 0;
+
+  idle_cycles = MIN2(idle_cycles, m_schedule->get_idle_cycles());
+  if (idle_cycles == 0) return 0;
+
+  idle_cycles = MIN2(idle_cycles, m_allocate->get_idle_cycles());
+  if (idle_cycles == 0) return 0;
+
+  idle_cycles = MIN2(idle_cycles, m_frontend->get_idle_cycles());
+
+  return idle_cycles;
+}
+
+void core_c::skip_cycles(Counter num_cycles) {
+  m_frontend->skip_cycles(num_cycles);
+
+  m_cycle += num_cycles;
+}
+
+void core_c::save_checkpoint(checkpoint_c* ckpt) {
+  ckpt->write(m_cycle);
+  m_icache->save_checkpoint(ckpt);
+}
+
+// the clock domains have already been advanced to the checkpoint cycle
+void core_c::restore_checkpoint(checkpoint_c* ckpt) {
+  m_cycle = ckpt->read<Counter>();
+  m_icache->restore_checkpoint(ckpt);
+
+  // forward progress is measured from the restored cycle
+  m_last_forward_progress = m_core_cycle_count;
+}
+
 // age entries in various queues
 void core_c::advance_queues(void) {
   // advance frontend queue
   m_q_frontend->advance();
 
   // advance allocation queue
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type  == "nvbit") {
+  if (is_acc_core()) {
     for (int i = 0; i < max_ALLOCQ; ++i) {
       m_gpu_q_iaq[i]->advance();
     }
@@ -653,7 +733,7 @@ void core_c::allocate_thread_data(int tid) {
   m_retire->allocate_retire_data(tid);
 
   // allocate scheduler queue and rob for GPU simulation
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type == "nvbit")
+  if (is_acc_core())
     m_gpu_rob->reserve_rob(tid); 
 }
 
@@ -686,7 +766,7 @@ void core_c::deallocate_thread_data(int tid) {
     m_last_terminated_tid = ++t_id;
   }
 
-  if (m_core_type == "ptx" || m_core_type == "igpu" || m_core_type == "nvbit") m_gpu_rob->free_rob(tid);
+  if (is_acc_core()) m_gpu_rob->free_rob(tid);
 
   // check forward progress
   if (m_unique_scheduled_thread_num >= m_last_terminated_tid + 1000) {
@@ -704,15 +784,15 @@ void core_c::deallocate_thread_data(int tid) {
 // train hardware prefetchers based on the event
 void core_c::train_hw_pref(int level, int tid, Addr addr, Addr pc, uop_c* uop,
                            bool hit) {
-  if (*m_simBase->m_knobs->KNOB_PREF_FRAMEWORK_ON && m_knob_enable_pref) {
+  if (KNOB_VALUE(KNOB_PREF_FRAMEWORK_ON) && m_knob_enable_pref) {
     m_hw_pref->train(level, tid, addr, pc, uop, hit);
   }
 }
 
 // hardware prefetcher initialization
 void core_c::pref_init(void) {
-  if (*m_simBase->m_knobs->KNOB_PREF_FRAMEWORK_ON && m_knob_enable_pref) {
-    m_hw_pref->pref_init((m_core_type == "ptx") || (m_core_type == "nvbit") ? true : false);
+  if (KNOB_VALUE(KNOB_PREF_FRAMEWORK_ON) && m_knob_enable_pref) {
+    m_hw_pref->pref_init(is_nvidia_core());
   }
 }
 
@@ -113,10 +113,42 @@ public:
    *  \brief Function to return core type
    *  \return string - Core type
    */
-  string get_core_type(void) {
+  const string& get_core_type(void) {
     return m_core_type;
   }
 
+  /*! \fn Core_Type get_core_type_id(void)
+   *  \brief Function to return core type without string compares
+   *  \return Core_Type - x86/a64/ptx/igpu/nvbit
+   */
+  Core_Type get_core_type_id(void) {
+    return m_core_type_id;
+  }
+
+  /*! \fn bool is_acc_core(void)
+   *  \brief Function to check whether this core runs accelerator (gpu) traces
+   *  \return bool - true for ptx, igpu and nvbit cores
+   */
+  bool is_acc_core(void) {
+    return m_core_type_id == CORE_PTX || m_core_type_id == CORE_IGPU ||
+           m_core_type_id == CORE_NVBIT;
+  }
+
+  /*! \fn bool is_nvidia_core(void)
+   *  \brief Function to check whether this core runs NVIDIA gpu traces
+   *  \return bool - true for ptx and nvbit cores
+   */
+  bool is_nvidia_core(void) {
+    return m_core_type_id == CORE_PTX || m_core_type_id == CORE_NVBIT;
+  }
+
+  /*! \fn Core_Type parse_core_type(const string& core_type)
+   *  \brief Function to convert a core_type knob value to the enum
+   *  \param core_type - knob value (x86, a64, ptx, igpu or nvbit)
+   *  \return Core_Type - core type
+   */
+  Core_Type parse_core_type(const string& core_type);
+
   /*! \fn Unit_type get_unit_type(void)
    *  \brief Function to return core unit type
    *  \return Unit_type - Core unit type: SMALL/MEDIUM/LARGE
@@ -137,6 +169,34 @@ public:
    */
   void run_a_cycle(bool);
 
+  /*! \fn Counter get_idle_cycles(void)
+   *  \brief Function to get the number of upcoming cycles in which no pipeline
+   *   stage changes its state
+   *  \return Counter - 0 if busy, ULLONG_MAX if waiting for the memory system
+   */
+  Counter get_idle_cycles(void);
+
+  /*! \fn void skip_cycles(Counter num_cycles)
+   *  \brief Function to advance the pipeline clock over idle cycles
+   *  \param num_cycles - number of skipped cycles
+   *  \return void
+   */
+  void skip_cycles(Counter num_cycles);
+
+  /*! \fn void save_checkpoint(checkpoint_c* ckpt)
+   *  \brief Function to save the core clock and the instruction cache
+   *  \param ckpt - checkpoint
+   *  \return void
+   */
+  void save_checkpoint(checkpoint_c* ckpt);
+
+  /*! \fn void restore_checkpoint(checkpoint_c* ckpt)
+   *  \brief Function to load the core clock and the instruction cache
+   *  \param ckpt - checkpoint
+   *  \return void
+   */
+  void restore_checkpoint(checkpoint_c* ckpt);
+
   /*! \fn Counter get_cycle_count(void)
    *  \brief Function to return cycle count for the core
    *  \return Counter - Cycle count of the core
@@ -145,12 +205,13 @@ public:
     return m_core_cycle_count;
   }
 
-  /*! \fn void inc_core_cycle_count(void)
+  /*! \fn void inc_core_cycle_count(Counter num_cycles)
    *  \brief Function to increment core cycle count
+   *  \param num_cycles - number of cycles
    *  \return void
    */
-  void inc_core_cycle_count(void) {
-    m_core_cycle_count++;
+  void inc_core_cycle_count(Counter num_cycles = 1) {
+    m_core_cycle_count += num_cycles;
   }
 
   /*! \fn void advance_queues(void)
@@ -381,6 +442,7 @@ public:
 private:
   int m_core_id; /**< core id */
   string m_core_type; /**< simulation core type (x86 or ptx) */
+  Core_Type m_core_type_id; /**< m_core_type resolved at construction */
   Unit_Type m_unit_type; /**< core type */
   int m_last_terminated_tid; /**< last terminated thread id */
   unordered_map<int, bool> m_terminated_tid; /**< ids of terminated threads */
@@ -428,6 +490,7 @@ private:
   bool m_knob_enable_pref; /**< enable hardware prefetcher */
   int m_max_threads_per_core; /**< max num (concurrently running) threads  */
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  const all_knob_values_s* m_knob_values; /**< knob snapshot for hot paths */
 
   // application id mapping
   unordered_map<int, process_s*>
@@ -0,0 +1,299 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : delta_trace.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Per-PC delta encoding of fixed-size trace records
+ *********************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "delta_trace.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// load a little-endian value of size bytes (8-byte fields are the common case)
+static inline uint64_t load_value(const char* src, int size) {
+  uint64_t value = 0;
+  if (size == 8)
+    memcpy(&value, src, 8);
+  else
+    memcpy(&value, src, size);
+  return value;
+}
+
+// store the low size bytes of a value
+static inline void store_value(char* dst, uint64_t value, int size) {
+  if (size == 8)
+    memcpy(dst, &value, 8);
+  else
+    memcpy(dst, &value, size);
+}
+
+// append a varint
+static inline void put_varint(std::vector<char>& dst, uint64_t value) {
+  while (value >= 0x80) {
+    dst.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  dst.push_back(static_cast<char>(value));
+}
+
+// append a zigzag varint of the signed difference (truncated to size bytes)
+static inline void put_delta(std::vector<char>& dst, uint64_t value, uint64_t base,
+                             int size) {
+  int shift = 64 - size * 8;
+  int64_t delta = static_cast<int64_t>((value - base) << shift) >> shift;
+  put_varint(dst, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+}
+
+// read a varint; returns false at the end of the stream
+static inline bool get_varint(const char*& src, const char* end, uint64_t& value) {
+  if (src < end && static_cast<uint8_t>(*src) < 0x80) {
+    value = static_cast<uint8_t>(*src++);
+    return true;
+  }
+
+  value = 0;
+  for (int shift = 0; shift < 64 && src < end; shift += 7) {
+    uint8_t byte = static_cast<uint8_t>(*src++);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+// read a zigzag varint delta and apply it to base
+static inline bool get_delta(const char*& src, const char* end, uint64_t base,
+                             uint64_t& value) {
+  uint64_t zigzag;
+  if (!get_varint(src, end, zigzag)) return false;
+  value = base + ((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// delta_trace_codec_c constructor
+delta_trace_codec_c::delta_trace_codec_c() {
+  m_record_size = 0;
+  m_pc_field = -1;
+  m_last_pc = 0;
+}
+
+// add a field to the layout
+void delta_trace_codec_c::add_field(uint16_t offset, uint8_t size, uint8_t kind) {
+  delta_trace_field_s field;
+  field.m_offset = offset;
+  field.m_size = size;
+  field.m_kind = kind;
+  m_fields.push_back(field);
+  m_record_size = 0;
+}
+
+// validate the layout and cover the remaining bytes with raw fields
+bool delta_trace_codec_c::set_record_size(uint32_t record_size) {
+  m_record_size = 0;
+  m_pc_field = -1;
+
+  std::sort(m_fields.begin(), m_fields.end(),
+            [](const delta_trace_field_s& a, const delta_trace_field_s& b) {
+              return a.m_offset < b.m_offset;
+            });
+
+  std::vector<delta_trace_field_s> fields;
+  uint32_t offset = 0;
+  for (auto I = m_fields.begin(), E = m_fields.end(); I != E; ++I) {
+    if ((*I).m_offset < offset || (*I).m_size == 0 ||
+        (*I).m_offset + (*I).m_size > record_size || (*I).m_kind > DELTA_FIELD_PC)
+      return false;
+    if ((*I).m_kind != DELTA_FIELD_RAW && (*I).m_size > 8) return false;
+
+    if ((*I).m_offset > offset) {
+      delta_trace_field_s gap;
+      gap.m_offset = offset;
+      gap.m_size = (*I).m_offset - offset;
+      gap.m_kind = DELTA_FIELD_RAW;
+      fields.push_back(gap);
+    }
+    if ((*I).m_kind == DELTA_FIELD_PC) {
+      if (m_pc_field != -1) return false;
+      m_pc_field = fields.size();
+    }
+    fields.push_back(*I);
+    offset = (*I).m_offset + (*I).m_size;
+  }
+
+  // raw fields are at most 255 bytes; split the tail if needed
+  while (offset < record_size) {
+    delta_trace_field_s gap;
+    gap.m_offset = offset;
+    gap.m_size = std::min<uint32_t>(record_size - offset, 255);
+    gap.m_kind = DELTA_FIELD_RAW;
+    fields.push_back(gap);
+    offset += gap.m_size;
+  }
+
+  // the pc field does not take a bit in the change mask
+  if (m_pc_field == -1 || fields.size() > DELTA_TRACE_MAX_FIELD + 1) {
+    m_pc_field = -1;
+    return false;
+  }
+
+  m_fields = fields;
+  m_mask_fields.clear();
+  for (int ii = 0, num_field = m_fields.size(); ii < num_field; ++ii)
+    if (ii != m_pc_field) m_mask_fields.push_back(m_fields[ii]);
+  m_record_size = record_size;
+  reset();
+
+  return true;
+}
+
+// record size
+uint32_t delta_trace_codec_c::get_record_size(void) const {
+  return m_record_size;
+}
+
+// record layout
+const std::vector<delta_trace_field_s>& delta_trace_codec_c::get_fields(void) const {
+  return m_fields;
+}
+
+// forget all previously seen instructions
+void delta_trace_codec_c::reset(void) {
+  m_pc_table.clear();
+  m_zero.assign(m_record_size, 0);
+  m_last_pc = 0;
+}
+
+// worst case: every field changes and every delta takes a full 10-byte varint
+size_t delta_trace_codec_c::encode_bound(size_t size) const {
+  size_t record_bound = 20;
+  for (auto I = m_fields.begin(), E = m_fields.end(); I != E; ++I)
+    record_bound += ((*I).m_kind == DELTA_FIELD_RAW) ? (*I).m_size : 10;
+
+  return (size / m_record_size) * record_bound + size % m_record_size;
+}
+
+// last record seen with pc; record becomes the last one
+const char* delta_trace_codec_c::find_record(uint64_t pc, const char* record) {
+  const char*& last = m_pc_table[pc];
+  const char* result = last ? last : m_zero.data();
+  last = record;
+
+  return result;
+}
+
+// encode raw records
+void delta_trace_codec_c::encode(const char* src, size_t size, std::vector<char>& dst) {
+  const delta_trace_field_s& pc_field = m_fields[m_pc_field];
+  const char* end = src + (size / m_record_size) * m_record_size;
+
+  reset();
+
+  for (; src < end; src += m_record_size) {
+    uint64_t pc = load_value(src + pc_field.m_offset, pc_field.m_size);
+    put_delta(dst, pc, m_last_pc, pc_field.m_size);
+    m_last_pc = pc;
+
+    const char* last = find_record(pc, src);
+
+    uint64_t mask = 0;
+    for (int ii = 0, num_field = m_mask_fields.size(); ii < num_field; ++ii) {
+      const delta_trace_field_s& field = m_mask_fields[ii];
+      if (memcmp(src + field.m_offset, last + field.m_offset, field.m_size))
+        mask |= 1ull << ii;
+    }
+    put_varint(dst, mask);
+
+    for (int ii = 0, num_field = m_mask_fields.size(); ii < num_field; ++ii) {
+      const delta_trace_field_s& field = m_mask_fields[ii];
+      if (mask & (1ull << ii)) {
+        if (field.m_kind == DELTA_FIELD_ADDR)
+          put_delta(dst, load_value(src + field.m_offset, field.m_size),
+                    load_value(last + field.m_offset, field.m_size), field.m_size);
+        else
+          dst.insert(dst.end(), src + field.m_offset, src + field.m_offset + field.m_size);
+      }
+    }
+  }
+
+  // partial record at the end of the trace
+  dst.insert(dst.end(), end, end + size % m_record_size);
+}
+
+// decode records
+bool delta_trace_codec_c::decode(const char* src, size_t src_size, char* dst, size_t size) {
+  const delta_trace_field_s& pc_field = m_fields[m_pc_field];
+  const char* src_end = src + src_size;
+  char* end = dst + (size / m_record_size) * m_record_size;
+
+  reset();
+
+  for (; dst < end; dst += m_record_size) {
+    uint64_t pc, mask;
+    if (!get_delta(src, src_end, m_last_pc, pc)) return false;
+    pc = load_value(reinterpret_cast<const char*>(&pc), pc_field.m_size);
+    m_last_pc = pc;
+
+    const char* last = find_record(pc, dst);
+    memcpy(dst, last, m_record_size);
+    store_value(dst + pc_field.m_offset, pc, pc_field.m_size);
+
+    if (!get_varint(src, src_end, mask)) return false;
+    if (m_mask_fields.size() < 64 && (mask >> m_mask_fields.size())) return false;
+
+    // visit changed fields only
+    while (mask) {
+      const delta_trace_field_s& field = m_mask_fields[__builtin_ctzll(mask)];
+      mask &= mask - 1;
+      if (field.m_kind == DELTA_FIELD_ADDR) {
+        uint64_t value;
+        if (!get_delta(src, src_end, load_value(dst + field.m_offset, field.m_size), value))
+          return false;
+        store_value(dst + field.m_offset, value, field.m_size);
+      } else {
+        if (src_end - src < field.m_size) return false;
+        memcpy(dst + field.m_offset, src, field.m_size);
+        src += field.m_size;
+      }
+    }
+  }
+
+  size_t tail = size % m_record_size;
+  if (static_cast<size_t>(src_end - src) != tail) return false;
+  memcpy(end, src, tail);
+
+  return true;
+}
@@ -0,0 +1,141 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : delta_trace.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Per-PC delta encoding of fixed-size trace records
+ *********************************************************************************************/
+
+#ifndef DELTA_TRACE_H_INCLUDED
+#define DELTA_TRACE_H_INCLUDED
+
+#include <cstddef>
+#include <inttypes.h>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// Delta trace record encoding
+///
+/// A record layout splits a fixed-size trace record into fields. Exactly one field is the
+/// instruction address (DELTA_FIELD_PC); the others are either address-like values
+/// (DELTA_FIELD_ADDR) or plain bytes (DELTA_FIELD_RAW). Each record is encoded as
+///
+///   pc delta from the previous record | bitmask of changed fields | changed fields
+///
+/// where a field is 'changed' if it differs from the last record seen with the same pc.
+/// Static fields (opcode, registers, branch type) are therefore only stored for the first
+/// instance of an instruction, and address fields are stored as deltas from the previous
+/// instance (strides). Deltas are zigzag varints. Every encode/decode call starts with an
+/// empty per-pc table, so the block trace container can decode any block on its own.
+///////////////////////////////////////////////////////////////////////////////////////////////
+#define DELTA_FIELD_RAW 0
+#define DELTA_FIELD_ADDR 1
+#define DELTA_FIELD_PC 2
+#define DELTA_TRACE_MAX_FIELD 64
+
+typedef struct delta_trace_field_s {
+  uint16_t m_offset; /**< byte offset in the record */
+  uint8_t m_size; /**< field size (1-8 bytes for pc/address fields) */
+  uint8_t m_kind; /**< DELTA_FIELD_RAW, DELTA_FIELD_ADDR or DELTA_FIELD_PC */
+} delta_trace_field_s;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Delta trace record encoder/decoder
+///////////////////////////////////////////////////////////////////////////////////////////////
+class delta_trace_codec_c
+{
+public:
+  /**
+   * Constructor
+   */
+  delta_trace_codec_c();
+
+  /**
+   * Add a field to the layout
+   */
+  void add_field(uint16_t offset, uint8_t size, uint8_t kind);
+
+  /**
+   * Set the record size and validate the layout. Bytes not covered by any field become
+   * raw fields. Returns false if the layout is not usable.
+   */
+  bool set_record_size(uint32_t record_size);
+
+  /**
+   * Record size (0 if no valid layout is set)
+   */
+  uint32_t get_record_size(void) const;
+
+  /**
+   * Fields of the layout, sorted by offset
+   */
+  const std::vector<delta_trace_field_s>& get_fields(void) const;
+
+  /**
+   * Upper bound of the encoded size of size raw bytes
+   */
+  size_t encode_bound(size_t size) const;
+
+  /**
+   * Encode size raw bytes and append them to dst. A partial record at the end is copied
+   * as is.
+   */
+  void encode(const char* src, size_t size, std::vector<char>& dst);
+
+  /**
+   * Decode src into size raw bytes. Returns false on a malformed stream.
+   */
+  bool decode(const char* src, size_t src_size, char* dst, size_t size);
+
+private:
+  /**
+   * Forget all previously seen instructions
+   */
+  void reset(void);
+
+  /**
+   * Last record seen with the given pc (an all-zero record for a new pc). record, which
+   * must stay valid until the end of the call, becomes the last record of pc.
+   */
+  const char* find_record(uint64_t pc, const char* record);
+
+  uint32_t m_record_size; /**< record size */
+  int m_pc_field; /**< index of the pc field */
+  std::vector<delta_trace_field_s> m_fields; /**< record layout */
+  std::vector<delta_trace_field_s> m_mask_fields; /**< fields in change mask order */
+  std::unordered_map<uint64_t, const char*> m_pc_table; /**< pc -> last record */
+  std::vector<char> m_zero; /**< all-zero record */
+  uint64_t m_last_pc; /**< pc of the previous record */
+};
+
+#endif  // DELTA_TRACE_H_INCLUDED
@@ -41,3 +41,17 @@ dram_c::dram_c(macsim_c* simBase) : m_simBase(simBase) {
 
 dram_c::~dram_c() {
 }
+
+Counter dram_c::get_idle_cycles(void) {
+  return 0;
+}
+
+void dram_c::skip_cycles(Counter num_cycles) {
+  m_cycle += num_cycles;
+}
+
+void dram_c::save_checkpoint(checkpoint_c* ckpt) {
+}
+
+void dram_c::restore_checkpoint(checkpoint_c* ckpt) {
+}
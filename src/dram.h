@@ -70,6 +70,28 @@ public:
    */
   virtual void run_a_cycle(bool) = 0;
 
+  /**
+   * Number of upcoming cycles without any work (0: busy). Controllers that do
+   * not model it are always considered busy.
+   */
+  virtual Counter get_idle_cycles(void);
+
+  /**
+   * Advance the clock without running idle cycles
+   */
+  virtual void skip_cycles(Counter num_cycles);
+
+  /**
+   * Save controller state to a checkpoint. Controllers that do not model it save
+   * nothing.
+   */
+  virtual void save_checkpoint(checkpoint_c* ckpt);
+
+  /**
+   * Load controller state from a checkpoint
+   */
+  virtual void restore_checkpoint(checkpoint_c* ckpt);
+
 protected:
   /**
    * Send a packet to NOC
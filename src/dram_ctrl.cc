@@ -34,7 +34,10 @@ POSSIBILITY OF SUCH DAMAGE.
  * Description  : Dram Controller
  *********************************************************************************************/
 
+#include <algorithm>
+
 #include "assert_macros.h"
+#include "checkpoint.h"
 #include "debug_macros.h"
 #include "dram_ctrl.h"
 #include "memory.h"
@@ -48,8 +51,6 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #define DEBUG(args...) _DEBUG(*m_simBase->m_knobs->KNOB_DEBUG_DRAM, ##args)
 
-static int total_dram_bandwidth = 0;
-
 ///
 /// \todo replace g_memory with m_memory
 ///
@@ -94,8 +95,6 @@ const char* dram_ctrl_c::dram_state[DRAM_STATE_COUNT] = {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-int drb_entry_s::m_unique_id = 0;
-
 // drb_entry_s constructor
 drb_entry_s::drb_entry_s(macsim_c* simBase) {
   reset();
@@ -119,12 +118,16 @@ void drb_entry_s::reset() {
   m_size = 0;
   m_timestamp = 0;
   m_scheduled = 0;
+  m_prev = NULL;
+  m_next = NULL;
+  m_row_prev = NULL;
+  m_row_next = NULL;
 }
 
 // set a drb entry.
 void drb_entry_s::set(mem_req_s* mem_req, uint64_t bid, uint64_t rid,
                       uint64_t cid) {
-  m_id = m_unique_id++;
+  m_id = m_simBase->m_drb_id_gen++;
   m_addr = mem_req->m_addr;
   m_bid = bid;
   m_rid = rid;
@@ -148,6 +151,77 @@ void drb_entry_s::set(mem_req_s* mem_req, uint64_t bid, uint64_t rid,
   ASSERT(m_rid >= 0);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+// dram request buffer of a bank
+
+// drb_c constructor
+drb_c::drb_c() {
+  m_head = NULL;
+  m_tail = NULL;
+  m_size = 0;
+}
+
+// append a new entry.
+void drb_c::push_back(drb_entry_s* entry) {
+  entry->m_prev = m_tail;
+  entry->m_next = NULL;
+  if (m_tail)
+    m_tail->m_next = entry;
+  else
+    m_head = entry;
+  m_tail = entry;
+
+  auto itr = m_rows.find(entry->m_rid);
+  if (itr == m_rows.end()) {
+    entry->m_row_prev = NULL;
+    row_list_s row = {entry, entry};
+    m_rows.insert({entry->m_rid, row});
+  } else {
+    entry->m_row_prev = itr->second.m_tail;
+    itr->second.m_tail->m_row_next = entry;
+    itr->second.m_tail = entry;
+  }
+  entry->m_row_next = NULL;
+
+  ++m_size;
+}
+
+// remove an entry.
+void drb_c::remove(drb_entry_s* entry) {
+  if (entry->m_prev)
+    entry->m_prev->m_next = entry->m_next;
+  else
+    m_head = entry->m_next;
+  if (entry->m_next)
+    entry->m_next->m_prev = entry->m_prev;
+  else
+    m_tail = entry->m_prev;
+
+  if (entry->m_row_prev == NULL && entry->m_row_next == NULL) {
+    m_rows.erase(entry->m_rid);
+  } else {
+    row_list_s& row = m_rows[entry->m_rid];
+    if (entry->m_row_prev)
+      entry->m_row_prev->m_row_next = entry->m_row_next;
+    else
+      row.m_head = entry->m_row_next;
+    if (entry->m_row_next)
+      entry->m_row_next->m_row_prev = entry->m_row_prev;
+    else
+      row.m_tail = entry->m_row_prev;
+  }
+
+  entry->m_prev = entry->m_next = NULL;
+  entry->m_row_prev = entry->m_row_next = NULL;
+  --m_size;
+}
+
+// oldest entry of a row.
+drb_entry_s* drb_c::row_front(uint64_t rid) const {
+  auto itr = m_rows.find(rid);
+  return itr == m_rows.end() ? NULL : itr->second.m_head;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 // dram controller
 
@@ -159,7 +233,7 @@ dram_ctrl_c::dram_ctrl_c(macsim_c* simBase) : dram_c(simBase) {
   m_bus_width = *KNOB(KNOB_DRAM_BUS_WIDTH);
 
   // bank
-  m_buffer = new list<drb_entry_s*>[m_num_bank];
+  m_buffer = new drb_c[m_num_bank];
   m_buffer_free_list = new list<drb_entry_s*>[m_num_bank];
   m_current_list = new drb_entry_s*[m_num_bank];
   m_current_rid = new uint64_t[m_num_bank];
@@ -319,17 +393,18 @@ bool dram_ctrl_c::insert_new_req(mem_req_s* mem_req) {
 
 // When the buffer is full, flush all prefetches.
 void dram_ctrl_c::flush_prefetch(int bid) {
-  list<drb_entry_s*> done_list;
-  for (auto I = m_buffer[bid].begin(), E = m_buffer[bid].end(); I != E; ++I) {
-    if ((*I)->m_req->m_type == MRT_DPRF) {
-      done_list.push_back((*I));
+  vector<drb_entry_s*> done_list;
+  for (drb_entry_s* entry = m_buffer[bid].front(); entry; entry = entry->m_next) {
+    if (entry->m_req->m_type == MRT_DPRF) {
+      done_list.push_back(entry);
     }
   }
+  order_entries(bid, &done_list);
 
   for (auto I = done_list.begin(), E = done_list.end(); I != E; ++I) {
     MEMORY->free_req((*I)->m_req->m_core_id, (*I)->m_req);
-    m_buffer_free_list[bid].push_back((*I));
     m_buffer[bid].remove((*I));
+    m_buffer_free_list[bid].push_back((*I));
     --m_total_req;
   }
 }
@@ -378,6 +453,78 @@ void dram_ctrl_c::run_a_cycle(bool pll_lock) {
   ++m_cycle;
 }
 
+// number of upcoming cycles in which run_a_cycle() only repeats the same
+// per-cycle stats: every bank waits for a timer and nothing is queued
+Counter dram_ctrl_c::get_idle_cycles(void) {
+  if (!m_output_buffer->empty()) return 0;
+
+  Counter next_event = ULLONG_MAX;
+  if (m_tmp_output_buffer && !m_tmp_output_buffer->empty())
+    next_event = m_tmp_output_buffer->front()->m_rdy_cycle;
+
+  for (int ii = 0; ii < m_num_bank; ++ii) {
+    drb_entry_s* entry = m_current_list[ii];
+    if (entry == NULL) {
+      if (!m_buffer[ii].empty()) return 0;
+      continue;
+    }
+
+    next_event = MIN2(next_event, m_data_ready[ii]);
+    switch (entry->m_state) {
+      case DRAM_CMD_WAIT:
+        next_event = MIN2(next_event, m_bank_ready[ii]);
+        break;
+      case DRAM_DATA:
+        // waits for the data and then for the data bus
+        if (m_data_avail[ii] > m_cycle)
+          next_event = MIN2(next_event, m_data_avail[ii]);
+        else
+          next_event =
+            MIN2(next_event, m_dbus_ready[ii / m_num_bank_per_channel]);
+        break;
+      case DRAM_DATA_WAIT:
+        break;
+      default:
+        return 0;
+    }
+  }
+
+  // data bus idle stats change when the bus becomes available
+  for (int ii = 0; ii < m_num_channel; ++ii) {
+    if (m_dbus_ready[ii] > m_cycle)
+      next_event = MIN2(next_event, m_dbus_ready[ii]);
+  }
+
+  if (next_event <= m_cycle) return 0;
+
+  Counter idle_cycles = next_event - m_cycle;
+
+  // keep the starvation exception at the same cycle
+  if (m_total_req > 0)
+    idle_cycles = MIN2(idle_cycles, (Counter)(4999 - m_starvation_cycle));
+
+  return idle_cycles;
+}
+
+void dram_ctrl_c::skip_cycles(Counter num_cycles) {
+  if (m_total_req > 0 && m_num_completed_in_last_cycle == 0)
+    m_starvation_cycle += num_cycles;
+  else
+    m_starvation_cycle = 0;
+
+  m_cycle += num_cycles;
+}
+
+void dram_ctrl_c::save_checkpoint(checkpoint_c* ckpt) {
+  ckpt->write(m_num_bank);
+  ckpt->write_bytes(m_current_rid, sizeof(uint64_t) * m_num_bank);
+}
+
+void dram_ctrl_c::restore_checkpoint(checkpoint_c* ckpt) {
+  ckpt->check(m_num_bank, "number of dram banks");
+  ckpt->read_bytes(m_current_rid, sizeof(uint64_t) * m_num_bank);
+}
+
 // starvation checking.
 void dram_ctrl_c::progress_check(void) {
   // if there are requests, but not serviced, increment counter
@@ -423,10 +570,11 @@ void dram_ctrl_c::print_req(void) {
   // print all requests
   for (int ii = 0; ii < m_num_bank; ++ii) {
     fprintf(fp, "bank_id:%d\n", ii);
-    for (auto I = m_buffer[ii].begin(), E = m_buffer[ii].end(); I != E; ++I) {
+    for (drb_entry_s* entry = m_buffer[ii].front(); entry;
+         entry = entry->m_next) {
       fprintf(fp, "req_id:%-10d state:%-15s time:%lld delta:%lld\n",
-              (*I)->m_req->m_id, dram_state[(*I)->m_state], (*I)->m_timestamp,
-              m_cycle - (*I)->m_timestamp);
+              entry->m_req->m_id, dram_state[entry->m_state],
+              entry->m_timestamp, m_cycle - entry->m_timestamp);
     }
   }
 
@@ -453,45 +601,45 @@ void dram_ctrl_c::bank_schedule_complete(void) {
     if (m_data_ready[ii] <= m_cycle) {
       ASSERT(m_current_list[ii]->m_state == DRAM_DATA_WAIT);
 
-      // find same address entries
+      // find same address entries (same address, same row)
       if (*m_simBase->m_knobs->KNOB_DRAM_MERGE_REQUESTS) {
-        list<drb_entry_s*> temp_list;
-        for (auto I = m_buffer[ii].begin(), E = m_buffer[ii].end(); I != E;
-             ++I) {
-          if ((*I)->m_addr == m_current_list[ii]->m_addr) {
-            on_complete(*I);
-            if ((*I)->m_req->m_type == MRT_WB) {
-              DEBUG("MC[%d] merged_req:%d addr:0x%llx type:%s done\n", m_id,
-                    (*I)->m_req->m_id, (*I)->m_req->m_addr,
-                    mem_req_c::mem_req_type_name[(*I)->m_req->m_type]);
-              MEMORY->free_req((*I)->m_req->m_core_id, (*I)->m_req);
-            } else {
-              if (m_tmp_output_buffer) {
-                (*I)->m_req->m_rdy_cycle =
-                  m_cycle + *KNOB(KNOB_DRAM_ADDITIONAL_LATENCY);
-                m_tmp_output_buffer->push_back((*I)->m_req);
-              } else {
-                m_output_buffer->push_back((*I)->m_req);
-              }
-              (*I)->m_req->m_state = MEM_DRAM_DONE;
-              DEBUG("MC[%d] merged_req:%d addr:0x%llx typs:%s done\n", m_id,
-                    (*I)->m_req->m_id, (*I)->m_req->m_addr,
-                    mem_req_c::mem_req_type_name[(*I)->m_req->m_type]);
-            }
-            temp_list.push_back((*I));
-            m_num_completed_in_last_cycle = m_cycle;
+        vector<drb_entry_s*> temp_list;
+        for (drb_entry_s* entry = m_buffer[ii].row_front(m_current_list[ii]->m_rid);
+             entry; entry = entry->m_row_next) {
+          if (entry->m_addr == m_current_list[ii]->m_addr) {
+            temp_list.push_back(entry);
           }
         }
+        order_entries(ii, &temp_list);
 
         for (auto I = temp_list.begin(), E = temp_list.end(); I != E; ++I) {
+          on_complete(*I);
+          if ((*I)->m_req->m_type == MRT_WB) {
+            DEBUG("MC[%d] merged_req:%d addr:0x%llx type:%s done\n", m_id,
+                  (*I)->m_req->m_id, (*I)->m_req->m_addr,
+                  mem_req_c::mem_req_type_name[(*I)->m_req->m_type]);
+            MEMORY->free_req((*I)->m_req->m_core_id, (*I)->m_req);
+          } else {
+            if (m_tmp_output_buffer) {
+              (*I)->m_req->m_rdy_cycle =
+                m_cycle + *KNOB(KNOB_DRAM_ADDITIONAL_LATENCY);
+              m_tmp_output_buffer->push_back((*I)->m_req);
+            } else {
+              m_output_buffer->push_back((*I)->m_req);
+            }
+            (*I)->m_req->m_state = MEM_DRAM_DONE;
+            DEBUG("MC[%d] merged_req:%d addr:0x%llx typs:%s done\n", m_id,
+                  (*I)->m_req->m_id, (*I)->m_req->m_addr,
+                  mem_req_c::mem_req_type_name[(*I)->m_req->m_type]);
+          }
+          m_num_completed_in_last_cycle = m_cycle;
+
+          m_buffer[ii].remove((*I));
           (*I)->reset();
           m_buffer_free_list[ii].push_back((*I));
-          m_buffer[ii].remove((*I));
           STAT_EVENT(TOTAL_DRAM_MERGE);
           --m_total_req;
         }
-
-        temp_list.clear();
       }
 
       STAT_EVENT(DRAM_AVG_LATENCY_BASE);
@@ -655,7 +803,7 @@ void dram_ctrl_c::bank_schedule_new(void) {
 }
 
 // select highest priority request based on the policy.
-drb_entry_s* dram_ctrl_c::schedule(list<drb_entry_s*>* buffer) {
+drb_entry_s* dram_ctrl_c::schedule(drb_c* buffer) {
   ASSERT(!buffer->empty());
 
   // FCFS (First Come First Serve)
@@ -664,6 +812,11 @@ drb_entry_s* dram_ctrl_c::schedule(list<drb_entry_s*>* buffer) {
   return entry;
 }
 
+// FCFS: entries are collected in arrival order.
+void dram_ctrl_c::order_entries(int bid, vector<drb_entry_s*>* entries) {
+  // empty
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 // dram channel activity
 
@@ -783,7 +936,6 @@ bool dram_ctrl_c::avail_data_bus(int channel_id) {
 // acquire data bus.
 Counter dram_ctrl_c::acquire_data_bus(int channel_id, int req_size,
                                       bool gpu_req) {
-  total_dram_bandwidth += req_size;
   STAT_EVENT_N(BANDWIDTH_TOT, req_size);
 
   Counter latency;
@@ -822,10 +974,17 @@ dc_frfcfs_c::sort_func::sort_func(dc_frfcfs_c* parent) {
   m_parent = parent;
 }
 
+// requests that arrived after the last decision of the bank follow in arrival order
 bool dc_frfcfs_c::sort_func::operator()(const drb_entry_s* req_a,
                                         const drb_entry_s* req_b) {
   int bid = req_a->m_bid;
-  int current_rid = m_parent->m_current_rid[bid];
+  int current_rid = m_parent->m_sched_rid[bid];
+
+  bool ranked_a = req_a->m_timestamp < m_parent->m_sched_cycle[bid];
+  bool ranked_b = req_b->m_timestamp < m_parent->m_sched_cycle[bid];
+  if (ranked_a != ranked_b) return ranked_a;
+
+  if (!ranked_a) return req_a->m_timestamp < req_b->m_timestamp;
 
   if (req_a->m_req->m_type != MRT_DPRF && req_b->m_req->m_type == MRT_DPRF)
     return true;
@@ -842,15 +1001,50 @@ bool dc_frfcfs_c::sort_func::operator()(const drb_entry_s* req_a,
 
 dc_frfcfs_c::dc_frfcfs_c(macsim_c* simBase) : dram_ctrl_c(simBase) {
   m_sort = new sort_func(this);
+  m_sched_cycle = new Counter[m_num_bank];
+  m_sched_rid = new uint64_t[m_num_bank];
+  for (int ii = 0; ii < m_num_bank; ++ii) {
+    m_sched_cycle[ii] = 0;
+    m_sched_rid[ii] = ULLONG_MAX;
+  }
 }
 
 dc_frfcfs_c::~dc_frfcfs_c() {
+  delete m_sort;
+  delete[] m_sched_cycle;
+  delete[] m_sched_rid;
 }
 
-drb_entry_s* dc_frfcfs_c::schedule(list<drb_entry_s*>* buffer) {
-  buffer->sort(*m_sort);
+// oldest demand row hit, oldest demand, oldest prefetch row hit, oldest prefetch
+drb_entry_s* dc_frfcfs_c::schedule(drb_c* buffer) {
+  ASSERT(!buffer->empty());
+
+  drb_entry_s* oldest = buffer->front();
+  int bid = oldest->m_bid;
+  int current_rid = m_current_rid[bid];
 
-  return buffer->front();
+  m_sched_cycle[bid] = m_cycle;
+  m_sched_rid[bid] = m_current_rid[bid];
+
+  drb_entry_s* prf_row_hit = NULL;
+  for (drb_entry_s* entry = buffer->row_front(current_rid); entry;
+       entry = entry->m_row_next) {
+    if (entry->m_req->m_type != MRT_DPRF) return entry;
+    if (prf_row_hit == NULL) prf_row_hit = entry;
+  }
+
+  for (drb_entry_s* entry = oldest; entry; entry = entry->m_next) {
+    if (entry->m_req->m_type != MRT_DPRF) return entry;
+  }
+
+  return prf_row_hit ? prf_row_hit : oldest;
+}
+
+// rank entries the way the last decision of the bank did
+//   entries arrive in buffer order; keep it among ties like list::sort did
+void dc_frfcfs_c::order_entries(int bid, vector<drb_entry_s*>* entries) {
+  if (entries->size() > 1)
+    std::stable_sort(entries->begin(), entries->end(), *m_sort);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -881,6 +1075,13 @@ void dram_simple_ctrl_c::run_a_cycle(bool pll_lock) {
   ++m_cycle;
 }
 
+Counter dram_simple_ctrl_c::get_idle_cycles(void) {
+  if (m_output_buffer->empty()) return ULLONG_MAX;
+
+  Counter rdy_cycle = m_output_buffer->front()->m_rdy_cycle;
+  return (rdy_cycle > m_cycle) ? rdy_cycle - m_cycle : 0;
+}
+
 void dram_simple_ctrl_c::send(void) {
   vector<mem_req_s*> temp_list;
 
@@ -39,6 +39,8 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include <list>
 #include <fstream>
+#include <unordered_map>
+#include <vector>
 
 #include "macsim.h"
 #include "dram.h"
@@ -60,7 +62,6 @@ enum DRAM_STATE {
 /// \brief dram request entry class
 ///////////////////////////////////////////////////////////////////////////////////////////////
 typedef struct drb_entry_s {
-  static int m_unique_id; /**< unique drb entry id */
   int m_id; /**< drb entry id */
   int m_state; /**< state */
   Addr m_addr; /**< request address */
@@ -76,6 +77,10 @@ typedef struct drb_entry_s {
   int m_size; /**< size */
   Counter m_timestamp; /**< last touched cycle */
   Counter m_scheduled; /**< scheduled cycle */
+  drb_entry_s* m_prev; /**< previous entry of the bank buffer (arrival order) */
+  drb_entry_s* m_next; /**< next entry of the bank buffer (arrival order) */
+  drb_entry_s* m_row_prev; /**< previous entry with the same row id */
+  drb_entry_s* m_row_next; /**< next entry with the same row id */
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
   // m_type;
   // m_core_type;
@@ -97,6 +102,72 @@ typedef struct drb_entry_s {
   void reset();
 } drb_entry_s;
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief dram request buffer (DRB) of a bank
+///
+/// Entries are linked in arrival order and, through a row id index, in per-row arrival
+/// order, so the oldest entry and the oldest entry of a row are found in O(1) and an
+/// entry is removed in O(1). The links live in drb_entry_s.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class drb_c
+{
+public:
+  /**
+   * Constructor
+   */
+  drb_c();
+
+  /**
+   * Append a new entry (youngest)
+   */
+  void push_back(drb_entry_s* entry);
+
+  /**
+   * Remove an entry
+   */
+  void remove(drb_entry_s* entry);
+
+  /**
+   * Oldest entry (NULL if empty). Follow m_next for younger entries.
+   */
+  drb_entry_s* front(void) const {
+    return m_head;
+  }
+
+  /**
+   * Oldest entry of a row (NULL if none). Follow m_row_next for younger entries.
+   */
+  drb_entry_s* row_front(uint64_t rid) const;
+
+  /**
+   * Check whether the buffer is empty
+   */
+  bool empty(void) const {
+    return m_head == NULL;
+  }
+
+  /**
+   * Number of entries
+   */
+  int size(void) const {
+    return m_size;
+  }
+
+private:
+  /**
+   * \brief first and last entry of a row
+   */
+  typedef struct row_list_s {
+    drb_entry_s* m_head; /**< oldest entry */
+    drb_entry_s* m_tail; /**< youngest entry */
+  } row_list_s;
+
+  drb_entry_s* m_head; /**< oldest entry */
+  drb_entry_s* m_tail; /**< youngest entry */
+  int m_size; /**< number of entries */
+  unordered_map<uint64_t, row_list_s> m_rows; /**< row id index */
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief Base dram scheduling class (FCFS)
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +207,26 @@ public:
    */
   void run_a_cycle(bool);
 
+  /**
+   * Number of upcoming cycles in which no bank or bus changes its state.
+   */
+  Counter get_idle_cycles(void);
+
+  /**
+   * Advance the clock without running idle cycles.
+   */
+  void skip_cycles(Counter num_cycles);
+
+  /**
+   * Save the open row of each bank (requests in flight are not saved).
+   */
+  void save_checkpoint(checkpoint_c* ckpt);
+
+  /**
+   * Load the open row of each bank.
+   */
+  void restore_checkpoint(checkpoint_c* ckpt);
+
   /**
    * Print requests in the buffer
    */
@@ -168,7 +259,14 @@ protected:
    * Pick the highest priority entry based one the policy.
    * Each dram scheduling policy should override this function.
    */
-  virtual drb_entry_s* schedule(list<drb_entry_s*>* drb_list);
+  virtual drb_entry_s* schedule(drb_c* buffer);
+
+  /**
+   * Put entries of a bank in the order the policy ranked them at its last decision.
+   * Merged requests and flushed prefetches are handled in this order.
+   * The default (FCFS) order is the arrival order.
+   */
+  virtual void order_entries(int bid, vector<drb_entry_s*>* entries);
 
   /**
    * Schedule each dram channel
@@ -239,7 +337,7 @@ protected:
   virtual void on_run_a_cycle();
 
 protected:
-  list<drb_entry_s*>* m_buffer; /**< Dram request buffer (DRB) */
+  drb_c* m_buffer; /**< Dram request buffer (DRB) */
   list<drb_entry_s*>* m_buffer_free_list; /**< DRB free list */
   drb_entry_s** m_current_list; /**< Currently servicing request in each DRB */
   uint64_t* m_current_rid; /**< Current open row id */
@@ -276,11 +374,15 @@ protected:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief FR-FCFS dram scheduling
+///
+/// Priority: demand requests before prefetches, then requests to the open row, then the
+/// oldest. The oldest row hit comes from the row id index of the bank buffer, so a
+/// selection only walks over prefetches that precede the chosen entry.
 ///////////////////////////////////////////////////////////////////////////////////////////////
 class dc_frfcfs_c : public dram_ctrl_c
 {
   /**
-   * \brief dc_frfcfs_c sort function
+   * \brief dc_frfcfs_c priority order at the last decision of a bank
    */
   class sort_func
   {
@@ -313,12 +415,19 @@ public:
 
   /**
    * Overloaded schedule function
-   * @param drb_list - dram request buffer to be scheduled
+   * @param buffer - dram request buffer to be scheduled
    */
-  drb_entry_s* schedule(list<drb_entry_s*>* drb_list);
+  drb_entry_s* schedule(drb_c* buffer);
+
+  /**
+   * Overloaded order function
+   */
+  void order_entries(int bid, vector<drb_entry_s*>* entries);
 
 private:
   class sort_func* m_sort; /**< sort function */
+  Counter* m_sched_cycle; /**< cycle of the last decision of each bank */
+  uint64_t* m_sched_rid; /**< open row at the last decision of each bank */
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -348,6 +457,11 @@ public:
    */
   void run_a_cycle(bool);
 
+  /**
+   * Number of upcoming cycles until the next request leaves the controller.
+   */
+  Counter get_idle_cycles(void);
+
   /**
    * Print all requests in the DRAM request buffer
    */
@@ -109,7 +109,8 @@ void dyfr_c::update(void) {
   //
   // With the aid of monitor variables, you could use these functions to
   // change any cores and other part of the system frequencies.
-  // Frequencies in macsim are int and 10X. (1.5GHz == 15)
+  // Frequencies in macsim are int, scaled by the same power of 10 so that
+  // every configured frequency is an integer. (1.5GHz == 15 with 1.0GHz LLC)
   //    * m_simBase->get_current_frequency_core(core_id);
   //          return the current frequency of a core
   //    * m_simBase->get_current_frequency_uncore(type);
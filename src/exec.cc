@@ -132,6 +132,7 @@ static Uop_LatencyBinding_Init uop_latencybinding_init_nvbit[] = {
 exec_c::exec_c(EXEC_INTERFACE_PARAMS(), macsim_c* simBase)
   : EXEC_INTERFACE_INIT() {
   m_simBase = simBase;
+  m_knob_values = simBase->m_knob_values;
 
   EXEC_CONFIG();
 
@@ -232,7 +233,7 @@ void exec_c::clear_ports() {
 // get uop latency
 int exec_c::get_latency(Uop_Type uop_type) {
   // when *m_simBase->m_knobs->KNOB_ONE_CYCLE_EXEC is set, all uops have 1-cyce latency
-  if (*m_simBase->m_knobs->KNOB_ONE_CYCLE_EXEC) {
+  if (KNOB_VALUE(KNOB_ONE_CYCLE_EXEC)) {
     return 1;
   }
 
@@ -298,7 +299,7 @@ bool exec_c::exec(int thread_id, int entry, uop_c* uop) {
   // -------------------------------------
   if (type != NOT_MEM) {
     // perfect dcache
-    if (KNOB(KNOB_PERFECT_DCACHE)->getValue()) {
+    if (KNOB_VALUE(KNOB_PERFECT_DCACHE)) {
       uop_latency = 1;
     } else {
       // -------------------------------------
@@ -551,7 +552,7 @@ bool exec_c::exec(int thread_id, int entry, uop_c* uop) {
 
       // GPU : if we use load-block policy, block current thread due to load instruction
       if (uop_latency == -1 && m_acc_sim &&
-          *m_simBase->m_knobs->KNOB_FETCH_ONLY_LOAD_READY) {
+          KNOB_VALUE(KNOB_FETCH_ONLY_LOAD_READY)) {
         m_frontend->set_load_wait(uop->m_thread_id, uop->m_uop_num);
 
         DEBUG_CORE(m_core_id,
@@ -621,13 +622,13 @@ bool exec_c::exec(int thread_id, int entry, uop_c* uop) {
       case UOP_REL_FENCE:
       case UOP_ACQ_FENCE:
         uop_latency = -1;
-        if (KNOB(KNOB_FENCE_ENABLE)->getValue()) {
+        if (KNOB_VALUE(KNOB_FENCE_ENABLE)) {
           DEBUG_CORE(
             m_core_id,
             "thread_id:%d uop_num:%llu inst_num:%llu fence operations exec \n",
             uop->m_thread_id, uop->m_uop_num, uop->m_inst_num);
 
-          if (KNOB(KNOB_ACQ_REL)->getValue() == false) {
+          if (KNOB_VALUE(KNOB_ACQ_REL) == false) {
             m_rob->ins_fence_entry(entry, FENCE_FULL);
             if (m_rob->pending_mem_ops(entry)) {
               return false;
@@ -667,7 +668,7 @@ bool exec_c::exec(int thread_id, int entry, uop_c* uop) {
   if (uop_latency > 0) {
     int max_latency =
       std::max(uop_latency,
-               static_cast<int>(*m_simBase->m_knobs->KNOB_EXEC_RETIRE_LATENCY));
+               static_cast<int>(KNOB_VALUE(KNOB_EXEC_RETIRE_LATENCY)));
     uop->m_done_cycle = m_cur_core_cycle + max_latency;
   }
 
@@ -717,7 +718,7 @@ void exec_c::br_exec(uop_c* uop) {
   if (uop->m_mispredicted) {
     (m_bp_data->m_bp)->recover(&(uop->m_recovery_info));
     m_bp_data->m_bp_recovery_cycle[uop->m_thread_id] =
-      m_cur_core_cycle + 1 + *m_simBase->m_knobs->KNOB_EXTRA_RECOVERY_CYCLES;
+      m_cur_core_cycle + 1 + KNOB_VALUE(KNOB_EXTRA_RECOVERY_CYCLES);
     m_bp_data->m_bp_cause_op[uop->m_thread_id] = 0;
 
     STAT_CORE_EVENT(m_core_id, BP_RESOLVED);
@@ -739,7 +740,7 @@ void exec_c::br_exec(uop_c* uop) {
 
       // redirect cycle
       m_bp_data->m_bp_redirect_cycle[uop->m_thread_id] =
-        m_cur_core_cycle + 1 + *m_simBase->m_knobs->KNOB_EXTRA_RECOVERY_CYCLES;
+        m_cur_core_cycle + 1 + KNOB_VALUE(KNOB_EXTRA_RECOVERY_CYCLES);
 
       uop->m_uop_info.m_btb_miss_resolved = true;
       DEBUG_CORE(m_core_id,
@@ -753,7 +754,7 @@ void exec_c::br_exec(uop_c* uop) {
   }
 
   // GPU : stall on branch policy
-  if (m_acc_sim && *m_simBase->m_knobs->KNOB_MT_NO_FETCH_BR) {
+  if (m_acc_sim && KNOB_VALUE(KNOB_MT_NO_FETCH_BR)) {
     m_frontend->set_br_ready(uop->m_thread_id);
   }
 }
@@ -810,7 +811,7 @@ void exec_c::run_a_cycle(void) {
           uop_c* puop = uop->m_parent_uop;
           ++puop->m_num_child_uops_done;
           if (puop->m_num_child_uops_done == puop->m_num_child_uops) {
-            if (*m_simBase->m_knobs->KNOB_FETCH_ONLY_LOAD_READY) {
+            if (KNOB_VALUE(KNOB_FETCH_ONLY_LOAD_READY)) {
               m_simBase->m_core_pointers[puop->m_core_id]
                 ->get_frontend()
                 ->set_load_ready(puop->m_thread_id, puop->m_uop_num);
@@ -821,7 +822,7 @@ void exec_c::run_a_cycle(void) {
           }
         }  // uop->m_parent_uop
         else {
-          if (*m_simBase->m_knobs->KNOB_FETCH_ONLY_LOAD_READY) {
+          if (KNOB_VALUE(KNOB_FETCH_ONLY_LOAD_READY)) {
             m_simBase->m_core_pointers[uop->m_core_id]
               ->get_frontend()
               ->set_load_ready(uop->m_thread_id, uop->m_uop_num);
@@ -833,7 +834,7 @@ void exec_c::run_a_cycle(void) {
       uop->m_state = OS_SCHEDULED;
 
       // HMC atomics nobypass cache case
-      if (!(*KNOB(KNOB_ENABLE_HMC_BYPASS_CACHE)))
+      if (!(KNOB_VALUE(KNOB_ENABLE_HMC_BYPASS_CACHE)))
         if (uop->m_mem_type == MEM_ST && uop->m_hmc_inst != HMC_NONE) {
           Counter mem_delay = uop->m_done_cycle - uop->m_exec_cycle;
           // cout << mem_delay << " " << hmc_type_c::HMC_Type2String(uop->m_hmc_inst) << endl;
@@ -841,7 +842,7 @@ void exec_c::run_a_cycle(void) {
           // Cache Hit: +ALU delay +one L1 hit
           if (mem_delay < 150) {
             STAT_CORE_EVENT(m_core_id, HMC_ADD_OVERHEAD_COUNT);
-            uop->m_done_cycle += *KNOB(KNOB_HMC_TEST_OVERHEAD);
+            uop->m_done_cycle += KNOB_VALUE(KNOB_HMC_TEST_OVERHEAD);
           }
         }
 
@@ -897,8 +898,8 @@ int exec_c::access_data_cache(uop_c* uop) {
   auto i = m_uop_buffer.find(key);
   ASSERTM(m_uop_buffer.end() == i, "uop has already been executed!\n");
 
-  int block_size = m_acc_sim ? KNOB(KNOB_L1_SMALL_LINE_SIZE)->getValue()
-                             : KNOB(KNOB_L1_LARGE_LINE_SIZE)->getValue();
+  int block_size = m_acc_sim ? KNOB_VALUE(KNOB_L1_SMALL_LINE_SIZE)
+                             : KNOB_VALUE(KNOB_L1_LARGE_LINE_SIZE);
   // Addr block_addr = uop->m_vaddr & ~((uint64_t)block_size-1);
 
   // if the requested block spans a cache line boundary, generate only one request for the first block
@@ -932,10 +933,10 @@ int exec_c::access_data_cache(uop_c* uop) {
     }
   }
   // mark highest bit if enabled cache bypass
-  if (hmc_type != 0 && (*KNOB(KNOB_ENABLE_HMC_BYPASS_CACHE)))
+  if (hmc_type != 0 && (KNOB_VALUE(KNOB_ENABLE_HMC_BYPASS_CACHE)))
     hmc_type = hmc_type | 0x0080;
   uint64_t trans_id = uop->m_hmc_trans_id;
-  if (!*KNOB(KNOB_ENABLE_HMC_TRANS)) trans_id = 0;
+  if (!KNOB_VALUE(KNOB_ENABLE_HMC_TRANS)) trans_id = 0;
 
   (*(m_simBase->sendDataCacheRequest))(m_core_id, key, uop->m_vaddr,
                                        uop->m_mem_size, uop->m_mem_type,
@@ -969,7 +970,7 @@ int exec_c::access_const_texture_cache(uop_c* uop) {
   auto i = m_uop_buffer.find(key);
   ASSERTM(m_uop_buffer.end() == i, "uop has already been executed!\n");
 
-  int block_size = KNOB(KNOB_L1_SMALL_LINE_SIZE)->getValue();
+  int block_size = KNOB_VALUE(KNOB_L1_SMALL_LINE_SIZE);
   // Addr block_addr = uop->m_vaddr & ~((uint64_t)block_size-1);
 
   // if the requested block spans a cache line boundary, generate only one request for the first block
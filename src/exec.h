@@ -195,6 +195,7 @@ private:
   bool* m_bank_busy; /**< indicate dcache bank busy */
 
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  const all_knob_values_s* m_knob_values; /**< knob snapshot for hot paths */
 
 #ifdef USING_SST
   uint64_t m_unique_request_id;
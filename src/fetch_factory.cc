@@ -43,7 +43,7 @@ POSSIBILITY OF SUCH DAMAGE.
 fetch_factory_c *fetch_factory_c::instance = 0;
 
 // fetch_factory_c constructor
-fetch_factory_c::fetch_factory_c() : m_func(NULL) {
+fetch_factory_c::fetch_factory_c() {
 }
 
 // fetch_factory_c destructor
@@ -72,20 +72,12 @@ frontend_c *fetch_factory_c::allocate_frontend(FRONTEND_INTERFACE_PARAMS(),
   // check function table is empty
   if (m_func_table.empty()) ASSERTM(0, "Fetch function not registered.\n");
 
-  // bind one fetch policy
-  // TDP: Is there a point of this guard other than
-  //      preventing multiple lookups?
-  //      KNOBS shouldn't be variable at runtime, right?
-  static bool fetch_factory_init = false;
-  if (!fetch_factory_init) {
-    fetch_factory_init = true;
-    string policy = m_simBase->m_knobs->KNOB_FETCH_POLICY->getValue();
-
-    ASSERTM(m_func_table.find(policy) != m_func_table.end(),
-            "Fetch function not found\n");
-    m_func = m_func_table[policy];
-  }
+  // bind one fetch policy (looked up per call: simulator instances in a
+  // sweep share this factory but may use different policies)
+  string policy = m_simBase->m_knobs->KNOB_FETCH_POLICY->getValue();
+  auto itr = m_func_table.find(policy);
+  ASSERTM(itr != m_func_table.end(), "Fetch function not found\n");
 
   // return a frontend object
-  return m_func(FRONTEND_INTERFACE_ARGS(), m_simBase);
+  return itr->second(FRONTEND_INTERFACE_ARGS(), m_simBase);
 }
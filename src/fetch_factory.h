@@ -79,10 +79,6 @@ public:
    */
   static fetch_factory_c *get();
 
-  /**
-   * Function to create a new object
-   */
-  function<frontend_c *(FRONTEND_INTERFACE_PARAMS(), macsim_c *)> m_func;
 
 public:
   static fetch_factory_c *instance; /**< singleton fetch factory object */
@@ -54,6 +54,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "bug_detector.h"
 #include "config.h"
 #include "process_manager.h"
+#include "sampler.h"
 #include "all_knobs.h"
 
 #define DEBUG(args...) \
@@ -158,6 +159,10 @@ frontend_c::frontend_c(FRONTEND_INTERFACE_PARAMS(), macsim_c *simBase)
 
   FRONTEND_CONFIG();
 
+  // sampled simulation covers cpu threads only
+  m_sampling = !m_acc_sim && *KNOB(KNOB_SAMPLE_FF_INSTS) > 0 &&
+               *KNOB(KNOB_SAMPLE_DETAIL_INSTS) > 0;
+
   // setting fetch policy
   string policy = m_simBase->m_knobs->KNOB_FETCH_POLICY->getValue();
   if (policy == "rr") {
@@ -336,6 +341,114 @@ void frontend_c::run_a_cycle(void) {
   }
 }
 
+// number of upcoming cycles in which run_a_cycle() cannot fetch anything.
+// only a single round-robin candidate is handled, so the arbiter state does
+// not rotate while cycles are skipped
+Counter frontend_c::get_idle_cycles(void) {
+  if (!m_fetching_thread_num) return ULLONG_MAX;
+
+  if (m_ptx_sim || m_nvbit_sim) return 0;
+
+  // fetch rate has to be aligned to the clock window
+  if (m_fetch_ratio != 1 &&
+      m_simBase->m_domain_freq[m_core_id] % m_fetch_ratio != 0)
+    return 0;
+
+  if (MT_fetch_scheduler != &frontend_c::fetch_rr ||
+      m_unique_scheduled_thread_num - m_last_terminated_tid > 1)
+    return 0;
+
+  core_c *core = m_simBase->m_core_pointers[m_core_id];
+  Counter cur_cycle = m_simBase->m_core_cycle[m_core_id] + 1;
+  for (int tid = m_last_terminated_tid; tid < m_unique_scheduled_thread_num;
+       ++tid) {
+    if (core->m_fetch_ended[tid] || core->m_thread_reach_end[tid])
+      continue;
+
+    if (KNOB(KNOB_NO_FETCH_ON_ICACHE_MISS)->getValue() &&
+        !check_fetch_ready(tid))
+      continue;
+
+    // without fetch state the thread is fetchable
+    frontend_s *fetch_data = core->get_trace_info(tid)->m_fetch_data;
+    if (fetch_data == NULL) return 0;
+    if (fetch_data->m_fetch_blocked) continue;
+
+    if (m_fe_stall || m_q_frontend->space() <= m_knob_fetch_width) continue;
+
+    // waiting for an icache fill
+    if (fetch_data->m_fe_mode == FRONTEND_MODE_WAIT_FOR_MISS &&
+        !check_fetch_ready(tid))
+      continue;
+
+    // waiting for branch misprediction recovery
+    if (fetch_data->m_fe_mode == FRONTEND_MODE_IFETCH &&
+        !fetch_data->m_first_time) {
+      Counter ready_cycle = MAX2(m_bp_data->m_bp_recovery_cycle[tid],
+                                 m_bp_data->m_bp_redirect_cycle[tid]);
+      if (ready_cycle > cur_cycle) return ready_cycle - cur_cycle;
+    }
+
+    return 0;
+  }
+
+  return ULLONG_MAX;
+}
+
+void frontend_c::skip_cycles(Counter num_cycles) {
+  if (m_fetching_thread_num && m_fetch_ratio != 1)
+    m_fetch_modulo = (m_fetch_modulo + num_cycles) % m_fetch_ratio;
+}
+
+// functional fetch of an instruction skipped by sampled simulation: the icache and the
+// branch predictors see the correct path only
+void frontend_c::warm_inst(int tid, Addr pc, int cf_type, bool taken,
+                           Addr target) {
+  thread_s *thread = m_core->get_trace_info(tid);
+  int appl_id = m_core->get_appl_id(tid);
+
+  // instruction cache : a miss is filled from L2 as in access_icache()
+  if (!*m_simBase->m_knobs->KNOB_PERFECT_ICACHE) {
+    Addr fetch_addr =
+      pc + m_icache->base_cache_line((unsigned long)UINT_MAX *
+                                     (thread->m_process->m_process_id) * 10ul);
+    Addr line_addr, repl_line_addr;
+    if (m_icache->access_cache(fetch_addr, &line_addr, true, appl_id) ==
+        NULL) {
+      m_icache->insert_cache(fetch_addr, &line_addr, &repl_line_addr, appl_id,
+                             false);
+      m_simBase->m_memory->warm_cache(m_core_id, tid, appl_id, line_addr, false,
+                                      MEM_L2);
+    }
+  }
+
+  if (cf_type == NOT_CF) return;
+
+  uop_c *uop = m_uop_pool->acquire_entry(m_simBase);
+  uop->allocate();
+  uop->m_core_id = m_core_id;
+  uop->m_thread_id = tid;
+  uop->m_pc = pc;
+  uop->m_cf_type = (Cf_Type)cf_type;
+  uop->m_dir = taken;
+  uop->m_target_addr = target;
+
+  // btb : learn the target as exec_c does after a misfetch
+  if (*KNOB(KNOB_ENABLE_BTB) &&
+      m_bp_data->m_bp_targ_pred->pred(uop) != uop->m_target_addr)
+    m_bp_data->m_bp_targ_pred->update(uop);
+
+  // direction predictor : predict, train and repair the history on a misprediction
+  if (uop->m_cf_type == CF_CBR) {
+    uns8 pred_dir = (m_bp_data->m_bp)->pred(uop);
+    (m_bp_data->m_bp)->update(uop);
+    if (pred_dir != uop->m_dir)
+      (m_bp_data->m_bp)->recover(&(uop->m_recovery_info));
+  }
+
+  m_uop_pool->release_entry(uop->free());
+}
+
 // fetch instructions from a thread
 FRONTEND_MODE frontend_c::process_ifetch(unsigned int tid,
                                          frontend_s *fetch_data) {
@@ -389,6 +502,12 @@ FRONTEND_MODE frontend_c::process_ifetch(unsigned int tid,
     }
   }
 
+  // -------------------------------------
+  // sampled simulation : wait until the detailed window retires, then fast-forward
+  // -------------------------------------
+  if (m_sampling && !m_simBase->m_sampler->fetch_ready(m_core_id, tid))
+    return FRONTEND_MODE_IFETCH;
+
   // -------------------------------------
   // check whether previous branch misprediction has been resolved
   // -------------------------------------
@@ -453,6 +572,10 @@ FRONTEND_MODE frontend_c::process_ifetch(unsigned int tid,
       // fetch instructions
       // -------------------------------------
       while ((m_q_frontend->space() > 0) && !break_fetch) {
+        // end of a detailed sampling window
+        if (m_sampling && m_simBase->m_sampler->window_end(m_core_id, tid))
+          return FRONTEND_MODE_IFETCH;
+
         // allocate a new uop
         uop_c *new_uop = m_uop_pool->acquire_entry(m_simBase);
 
@@ -221,6 +221,31 @@ public:
    */
   void run_a_cycle();
 
+  /*! \fn Counter get_idle_cycles()
+   *  \brief Function to get the number of upcoming cycles without any fetch
+   *  \return Counter - 0 if busy, ULLONG_MAX if waiting for an external event
+   */
+  Counter get_idle_cycles();
+
+  /*! \fn void skip_cycles(Counter num_cycles)
+   *  \brief Function to advance the fetch rate counter over idle cycles
+   *  \param num_cycles - number of skipped cycles
+   *  \return void
+   */
+  void skip_cycles(Counter num_cycles);
+
+  /*! \fn void warm_inst(int tid, Addr pc, int cf_type, bool taken, Addr target)
+   *  \brief Sampled simulation : update the instruction cache and branch predictors
+   *  with an instruction that is skipped functionally
+   *  \param tid - thread id
+   *  \param pc - instruction address
+   *  \param cf_type - control-flow type (Cf_Type, NOT_CF for other instructions)
+   *  \param taken - branch outcome
+   *  \param target - branch target
+   *  \return void
+   */
+  void warm_inst(int tid, Addr pc, int cf_type, bool taken, Addr target);
+
   /*! \fn void set_core_id(int c_id)
    *  \brief Function to set core id
    *  \param c_id - core id
@@ -416,6 +441,7 @@ protected:
   core_c* m_core; /**< core pointer */
   int m_mem_access_thread_num; /**< number of threads that access memory */
   int m_fetch_ratio; /**< how often fetch an instruction (GPU only) */
+  bool m_sampling; /**< sampled simulation (fast-forward between detailed windows) */
 
   bool m_dcache_bank_busy[129]; /**< dcache bank busy status */
 
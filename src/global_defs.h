@@ -117,6 +117,15 @@ class CoreStatistics;
 class cache_partition_framework_c;
 class dyfr_c;
 class MMU;
+class trace_file_c;
+class trace_prefetcher_c;
+class trace_store_c;
+class block_trace_reader_c;
+class checkpoint_c;
+class sampler_c;
+class stat_interval_c;
+class host_profiler_c;
+class inst_info_cache_c;
 
 template <class T>
 class pqueue_c;
@@ -128,6 +137,7 @@ class pool_c;
 ///////////////////////////////////////////////////////////////////////////////////////////////
 // Struct declarations
 
+struct all_knob_values_s;
 struct thread_trace_info_node_s;
 
 typedef struct mem_req_s mem_req_s;
@@ -72,6 +72,20 @@ typedef enum _Unit_Type_enum {
   UNIT_LARGE /**< large core */
 } Unit_Type;
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Core ISA (resolved once from the core_type knobs)
+/// Listed in the order of the knob strings; the thread scheduler visits core
+/// types in this order.
+///////////////////////////////////////////////////////////////////////////////////////////////
+typedef enum _Core_Type_enum {
+  CORE_A64 = 0, /**< arm64 core */
+  CORE_IGPU, /**< intel gpu core */
+  CORE_NVBIT, /**< NVBIT core */
+  CORE_PTX, /**< PTX core */
+  CORE_X86, /**< x86 core */
+  NUM_CORE_TYPES
+} Core_Type;
+
 typedef enum uop_latency_map {  // enum for x86 latency maps - Michael
   LATENCY_DEFAULT = 0,
   LATENCY_SKYLAKE,
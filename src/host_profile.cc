@@ -0,0 +1,95 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : host_profile.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Host-time profiler for simulator stages
+ *********************************************************************************************/
+
+#include <cstdio>
+
+#include "host_profile.h"
+#include "macsim.h"
+
+#include "all_knobs.h"
+#include "all_stats.h"
+#include "statistics.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char* host_prof_stage_name[HOST_PROF_STAGE_COUNT] = {
+  "other", "frontend", "trace", "allocate", "schedule", "exec",  "retire",
+  "pref",  "queue",    "mmu",   "noc",      "memory",   "dram"};
+
+// host_profiler_c constructor
+host_profiler_c::host_profiler_c(macsim_c* simBase) {
+  m_simBase = simBase;
+  m_active = -1;
+  for (int ii = 0; ii < HOST_PROF_STAGE_COUNT; ++ii) {
+    m_ticks[ii] = 0;
+    m_calls[ii] = 0;
+  }
+
+  m_start_time = std::chrono::steady_clock::now();
+  m_start_tick = now();
+}
+
+// print the breakdown and the simulation speed
+void host_profiler_c::print(void) {
+  uint64_t total_ticks = now() - m_start_tick;
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                 m_start_time)
+                     .count();
+  if (total_ticks == 0 || seconds <= 0) return;
+  double ticks_per_sec = total_ticks / seconds;
+
+  // time outside the timed stages (main loop, stats, finalization)
+  int64_t timed = 0;
+  for (int ii = 0; ii < HOST_PROF_STAGE_COUNT; ++ii) timed += m_ticks[ii];
+  m_ticks[HOST_PROF_OTHER] += total_ticks - timed;
+
+  FILE* out = m_simBase->g_mystdout;
+  fprintf(out, "host profile (%.3f s)\n", seconds);
+  fprintf(out, "  %-10s %12s %7s %14s %10s\n", "stage", "seconds", "%", "calls",
+          "ns/call");
+  for (int ii = 0; ii < HOST_PROF_STAGE_COUNT; ++ii) {
+    double stage_seconds = m_ticks[ii] / ticks_per_sec;
+    fprintf(out, "  %-10s %12.3f %7.2f %14llu", host_prof_stage_name[ii], stage_seconds,
+            100.0 * m_ticks[ii] / total_ticks, (unsigned long long)m_calls[ii]);
+    if (m_calls[ii])
+      fprintf(out, " %10.1f\n", 1e9 * stage_seconds / m_calls[ii]);
+    else
+      fprintf(out, " %10s\n", "-");
+  }
+
+  uint64_t num_inst = (*m_simBase->m_ProcessorStats)[INST_COUNT_TOT].getCount();
+  fprintf(out, "  simulated cycles/s : %.0f\n", m_simBase->m_simulation_cycle / seconds);
+  fprintf(out, "  retired insts/s    : %.0f\n", num_inst / seconds);
+}
@@ -0,0 +1,153 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : host_profile.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Host-time profiler for simulator stages
+ *********************************************************************************************/
+
+#ifndef HOST_PROFILE_H_INCLUDED
+#define HOST_PROFILE_H_INCLUDED
+
+#include <chrono>
+#include <inttypes.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "global_defs.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Profiled simulator stages
+///////////////////////////////////////////////////////////////////////////////////////////////
+typedef enum Host_Prof_Stage_enum {
+  HOST_PROF_OTHER = 0, /**< everything outside the stages below */
+  HOST_PROF_FRONTEND, /**< fetch (without trace reading) */
+  HOST_PROF_TRACE, /**< trace reading and decoding */
+  HOST_PROF_ALLOCATE, /**< allocate stage */
+  HOST_PROF_SCHEDULE, /**< schedule stage */
+  HOST_PROF_EXEC, /**< execution stage */
+  HOST_PROF_RETIRE, /**< retire stage */
+  HOST_PROF_PREF, /**< hardware prefetchers */
+  HOST_PROF_QUEUE, /**< per-core queue advance */
+  HOST_PROF_MMU, /**< MMU */
+  HOST_PROF_NOC, /**< interconnection network */
+  HOST_PROF_MEMORY, /**< cache hierarchy */
+  HOST_PROF_DRAM, /**< dram controllers */
+  HOST_PROF_STAGE_COUNT
+} Host_Prof_Stage;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Host-time profiler (KNOB_HOST_PROFILE)
+///
+/// Stages are timed with host_prof_scope_c (HOST_PROF_SCOPE). Time is exclusive: a stage
+/// that runs inside another one (trace reading inside fetch) is subtracted from its parent.
+/// The clock is the time stamp counter on x86 hosts and steady_clock elsewhere; ticks are
+/// converted to seconds with the rate measured over the whole run. When profiling is off
+/// m_host_profiler is NULL and every scope costs one branch.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class host_profiler_c
+{
+  friend class host_prof_scope_c;
+
+public:
+  /**
+   * Constructor (starts the wall clock)
+   */
+  host_profiler_c(macsim_c* simBase);
+
+  /**
+   * Print the breakdown and the simulation speed
+   */
+  void print(void);
+
+  /**
+   * Current host time in ticks
+   */
+  static inline uint64_t now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+  }
+
+private:
+  host_profiler_c();  // do not implement
+
+  macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  int64_t m_ticks[HOST_PROF_STAGE_COUNT]; /**< exclusive ticks per stage */
+  uint64_t m_calls[HOST_PROF_STAGE_COUNT]; /**< number of scopes per stage */
+  int m_active; /**< innermost running stage (-1: none) */
+  uint64_t m_start_tick; /**< ticks at construction */
+  std::chrono::steady_clock::time_point m_start_time; /**< wall time at construction */
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Scoped stage timer
+///////////////////////////////////////////////////////////////////////////////////////////////
+class host_prof_scope_c
+{
+public:
+  inline host_prof_scope_c(host_profiler_c* profiler, int stage)
+    : m_profiler(profiler), m_stage(stage), m_parent(-1), m_start(0) {
+    if (m_profiler == NULL) return;
+
+    m_parent = m_profiler->m_active;
+    m_profiler->m_active = stage;
+    m_start = host_profiler_c::now();
+  }
+
+  inline ~host_prof_scope_c() {
+    if (m_profiler == NULL) return;
+
+    int64_t ticks = host_profiler_c::now() - m_start;
+    m_profiler->m_ticks[m_stage] += ticks;
+    ++m_profiler->m_calls[m_stage];
+    if (m_parent >= 0) m_profiler->m_ticks[m_parent] -= ticks;
+    m_profiler->m_active = m_parent;
+  }
+
+private:
+  host_prof_scope_c();  // do not implement
+
+  host_profiler_c* m_profiler; /**< profiler (NULL: off) */
+  int m_stage; /**< timed stage */
+  int m_parent; /**< enclosing stage */
+  uint64_t m_start; /**< ticks at the start of the scope */
+};
+
+// time the rest of the enclosing block as stage
+#define HOST_PROF_SCOPE(stage) \
+  host_prof_scope_c host_prof_scope_##stage(m_simBase->m_host_profiler, stage)
+
+#endif  // HOST_PROFILE_H_INCLUDED
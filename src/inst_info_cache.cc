@@ -0,0 +1,155 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : inst_info_cache.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Decoded instruction cache (per process)
+ *********************************************************************************************/
+
+#include "inst_info_cache.h"
+#include "assert_macros.h"
+#include "inst_info.h"
+#include "macsim.h"
+#include "utils.h"
+
+#include "all_knobs.h"
+#include "statistics.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// inst_info_cache_c constructor
+inst_info_cache_c::inst_info_cache_c(macsim_c* simBase) {
+  m_simBase = simBase;
+  m_table.resize(INST_INFO_CACHE_INIT_SIZE);
+  m_mask = INST_INFO_CACHE_INIT_SIZE - 1;
+  m_shift = 64 - log2_int(INST_INFO_CACHE_INIT_SIZE);
+  m_size = 0;
+  m_pool = new pool_c<inst_info_s>(100, "inst_info_cache");
+
+  for (auto I = m_table.begin(), E = m_table.end(); I != E; ++I) (*I).m_info = NULL;
+  for (int ii = 0; ii < INST_INFO_CACHE_NUM_LAST; ++ii) m_last[ii].m_info = NULL;
+}
+
+// inst_info_cache_c destructor
+inst_info_cache_c::~inst_info_cache_c() {
+  clear();
+  delete m_pool;
+}
+
+// fibonacci hashing: the low bits of a key (uop index) spread over the whole table
+uint64_t inst_info_cache_c::hash(Addr key) const {
+  return (key * 0x9e3779b97f4a7c15ULL) >> m_shift;
+}
+
+// find a uop; create a new entry if not found
+inst_info_s* inst_info_cache_c::access_create(Addr key, bool* new_entry) {
+  uint64_t slot = hash(key);
+  while (m_table[slot].m_info != NULL) {
+    if (m_table[slot].m_key == key) {
+      *new_entry = false;
+      return m_table[slot].m_info;
+    }
+    slot = (slot + 1) & m_mask;
+  }
+
+  // keep the load factor below 1/2
+  if (2 * (m_size + 1) > static_cast<int>(m_table.size())) {
+    grow();
+    slot = hash(key);
+    while (m_table[slot].m_info != NULL) slot = (slot + 1) & m_mask;
+  }
+
+  inst_info_s* info = m_pool->acquire_entry();
+  m_table[slot].m_key = key;
+  m_table[slot].m_info = info;
+  ++m_size;
+
+  *new_entry = true;
+  return info;
+}
+
+// find the first uop of an instruction through the per-thread last instruction table
+inst_info_s* inst_info_cache_c::access_create(Addr key, bool* new_entry, int thread_id) {
+  entry_s& last = m_last[thread_id & (INST_INFO_CACHE_NUM_LAST - 1)];
+  if (last.m_info != NULL && last.m_key == key) {
+    STAT_EVENT(INST_INFO_CACHE_HIT);
+    STAT_EVENT(INST_INFO_CACHE_LAST_HIT);
+    *new_entry = false;
+    return last.m_info;
+  }
+
+  inst_info_s* info = access_create(key, new_entry);
+  if (*new_entry)
+    STAT_EVENT(INST_INFO_CACHE_MISS);
+  else
+    STAT_EVENT(INST_INFO_CACHE_HIT);
+
+  last.m_key = key;
+  last.m_info = info;
+
+  return info;
+}
+
+// number of cached uops
+int inst_info_cache_c::size(void) {
+  return m_size;
+}
+
+// release all entries
+void inst_info_cache_c::clear(void) {
+  for (auto I = m_table.begin(), E = m_table.end(); I != E; ++I) {
+    if ((*I).m_info != NULL) {
+      m_pool->release_entry((*I).m_info);
+      (*I).m_info = NULL;
+    }
+  }
+  for (int ii = 0; ii < INST_INFO_CACHE_NUM_LAST; ++ii) m_last[ii].m_info = NULL;
+  m_size = 0;
+}
+
+// double the table size and re-insert all entries
+void inst_info_cache_c::grow(void) {
+  std::vector<entry_s> table(m_table.size() * 2);
+  for (auto I = table.begin(), E = table.end(); I != E; ++I) (*I).m_info = NULL;
+
+  m_table.swap(table);
+  m_mask = m_table.size() - 1;
+  --m_shift;
+
+  for (auto I = table.begin(), E = table.end(); I != E; ++I) {
+    if ((*I).m_info == NULL) continue;
+
+    uint64_t slot = hash((*I).m_key);
+    while (m_table[slot].m_info != NULL) slot = (slot + 1) & m_mask;
+    m_table[slot] = *I;
+  }
+}
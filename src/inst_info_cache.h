@@ -0,0 +1,121 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : inst_info_cache.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Decoded instruction cache (per process)
+ *********************************************************************************************/
+
+#ifndef INST_INFO_CACHE_H_INCLUDED
+#define INST_INFO_CACHE_H_INCLUDED
+
+#include <vector>
+
+#include "global_defs.h"
+#include "global_types.h"
+
+#define INST_INFO_CACHE_INIT_SIZE 4096
+#define INST_INFO_CACHE_NUM_LAST 64
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Decoded instruction cache
+///
+/// Maps (pc << 3 | uop index) to the decoded inst_info_s of each uop. The table uses open
+/// addressing with linear probing, so a hit costs one hash and (usually) one cache line.
+/// Entries are never removed individually; clear() drops the whole table when a process
+/// terminates.
+///
+/// Lookups of the first uop of an instruction go through a small per-thread table that
+/// remembers the last instruction decoded by that thread (rep instructions, tight loops).
+///////////////////////////////////////////////////////////////////////////////////////////////
+class inst_info_cache_c
+{
+public:
+  /**
+   * Constructor
+   */
+  inst_info_cache_c(macsim_c* simBase);
+
+  /**
+   * Destructor
+   */
+  ~inst_info_cache_c();
+
+  /**
+   * Find a uop. If not found, create a new entry
+   */
+  inst_info_s* access_create(Addr key, bool* new_entry);
+
+  /**
+   * Find the first uop of an instruction decoded by thread_id. If not found, create a
+   * new entry. Updates the decoded instruction cache hit/miss stats.
+   */
+  inst_info_s* access_create(Addr key, bool* new_entry, int thread_id);
+
+  /**
+   * Number of cached uops
+   */
+  int size(void);
+
+  /**
+   * Release all entries
+   */
+  void clear(void);
+
+private:
+  inst_info_cache_c();  // do not implement
+
+  typedef struct entry_s {
+    Addr m_key; /**< pc << 3 | uop index */
+    inst_info_s* m_info; /**< decoded uop (NULL: empty slot) */
+  } entry_s;
+
+  /**
+   * Table slot of a key
+   */
+  uint64_t hash(Addr key) const;
+
+  /**
+   * Double the table size
+   */
+  void grow(void);
+
+  macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  std::vector<entry_s> m_table; /**< open addressing table */
+  uint64_t m_mask; /**< table size - 1 */
+  int m_shift; /**< hash shift (64 - log2(table size)) */
+  int m_size; /**< number of cached uops */
+  entry_s m_last[INST_INFO_CACHE_NUM_LAST]; /**< last instruction per thread */
+  pool_c<inst_info_s>* m_pool; /**< inst_info_s pool */
+};
+
+#endif  // INST_INFO_CACHE_H_INCLUDED
@@ -39,6 +39,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 #include <sstream>
 #include <sys/time.h>
+#include <cmath>
 
 #include "macsim.h"
 #include "assert_macros.h"
@@ -64,6 +65,11 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "dram.h"
 #include "dyfr.h"
 #include "mmu.h"
+#include "checkpoint.h"
+#include "sampler.h"
+#include "stat_interval.h"
+#include "host_profile.h"
+#include "trace_file.h"
 
 #include "all_knobs.h"
 #include "all_stats.h"
@@ -107,12 +113,27 @@ macsim_c::macsim_c() {
 
   m_pll_lockout = 0;
   m_hmc_trans_id_gen = 0;
+  m_drb_id_gen = 0;
+  m_pref_id_gen = 0;
+
+  m_idle_probe = false;
+  m_idle_windows = 0;
+
+  m_checkpoint = NULL;
+  m_sampler = NULL;
+  m_stat_interval = NULL;
+  m_host_profiler = NULL;
+  m_trace_prefetcher = NULL;
+  m_trace_store = NULL;
+  m_trace_store_user = 0;
+  m_knob_values = NULL;
 }
 
 // =======================================
 // Macsim destructor
 // =======================================
 macsim_c::~macsim_c() {
+  delete m_knob_values;
 }
 
 // =======================================
@@ -158,13 +179,23 @@ void macsim_c::init_knobs(int argc, char** argv) {
 #endif
 
   // save the states of all knobs to a file
-  m_knobsContainer->saveToFile("params.out");
+  m_knobsContainer->saveToFile(
+    KNOB(KNOB_STATISTICS_OUT_DIRECTORY)->getValue() + "/params.out");
+
+  // knobs are final from here on; components bind this copy at construction
+  m_knob_values = new all_knob_values_s;
+  m_knobs->snapshot(m_knob_values);
 }
 
 // =======================================
 // register wrapper functions to allocate objects later
 // =======================================
 void macsim_c::register_functions(void) {
+  // factories are process-wide singletons shared by all simulator instances
+  static bool registered = false;
+  if (registered) return;
+  registered = true;
+
   mem_factory_c::get()->register_class("llc_coupled_network", default_mem);
   mem_factory_c::get()->register_class("llc_decoupled_network", default_mem);
   mem_factory_c::get()->register_class("l2_coupled_local", default_mem);
@@ -204,7 +235,8 @@ void macsim_c::init_memory(void) {
   // pool allocation
   m_thread_pool = new pool_c<thread_s>(10, "thread_pool");
   m_section_pool = new pool_c<section_info_s>(100, "section_pool");
-  m_mem_map_entry_pool = new pool_c<mem_map_entry_c>(200, "mem_map_pool");
+  m_mem_map_entries = 0;
+  m_mem_map_max_entries = 0;
   m_heartbeat_pool = new pool_c<heartbeat_s>(10, "heartbeat_pool");
   m_bp_recovery_info_pool =
     new pool_c<bp_recovery_info_c>(10, "bp_recovery_info_pool");
@@ -255,6 +287,22 @@ void macsim_c::init_memory(void) {
   // Dynamic Frequency
   m_dyfr = new dyfr_c(this, m_num_sim_cores);
 
+  // checkpoints
+  m_checkpoint = new checkpoint_c(m_simBase);
+
+  // sampled simulation
+  m_sampler = new sampler_c(m_simBase);
+
+  // interval statistics
+  m_stat_interval = new stat_interval_c(m_simBase);
+
+  // trace read-ahead
+  if (*KNOB(KNOB_TRACE_PREFETCH_DEPTH) > 0) {
+    m_trace_prefetcher = new trace_prefetcher_c(*KNOB(KNOB_TRACE_PREFETCH_THREADS),
+                                                *KNOB(KNOB_TRACE_PREFETCH_DEPTH),
+                                                *KNOB(KNOB_TRACE_PREFETCH_CHUNK_SIZE));
+  }
+
   // ETC
   m_termination_check = new bool[m_num_sim_cores];
   fill_n(m_termination_check, m_num_sim_cores, false);
@@ -575,10 +623,18 @@ void macsim_c::open_traces(string trace_list) {
 // deallocate memory
 // =======================================
 void macsim_c::deallocate_memory(void) {
+  // pool high-water marks
+  STAT_EVENT_N(POOL_THREAD_MAX_IN_USE, m_thread_pool->get_max_in_use());
+  STAT_EVENT_N(POOL_SECTION_MAX_IN_USE, m_section_pool->get_max_in_use());
+  STAT_EVENT_N(POOL_MEM_MAP_MAX_IN_USE, m_mem_map_max_entries);
+  STAT_EVENT_N(POOL_HEARTBEAT_MAX_IN_USE, m_heartbeat_pool->get_max_in_use());
+  STAT_EVENT_N(POOL_BP_RECOVERY_INFO_MAX_IN_USE,
+               m_bp_recovery_info_pool->get_max_in_use());
+  STAT_EVENT_N(POOL_THREAD_NODE_MAX_IN_USE, m_trace_node_pool->get_max_in_use());
+
   // memory deallocation
   delete m_thread_pool;
   delete m_section_pool;
-  delete m_mem_map_entry_pool;
   delete m_heartbeat_pool;
   delete m_bp_recovery_info_pool;
   delete m_trace_node_pool;
@@ -597,6 +653,15 @@ void macsim_c::deallocate_memory(void) {
 
   if (*m_simBase->m_knobs->KNOB_BUG_DETECTOR_ENABLE) delete m_bug_detector;
 
+  delete m_trace_prefetcher;
+  m_trace_prefetcher = NULL;
+
+  delete m_checkpoint;
+  m_checkpoint = NULL;
+
+  delete m_sampler;
+  m_sampler = NULL;
+
   // deallocate cores
   int num_large_cores = *KNOB(KNOB_NUM_SIM_LARGE_CORES);
   int num_large_medium_cores =
@@ -763,10 +828,18 @@ void macsim_c::initialize(int argc, char** argv) {
   m_MMU = make_unique<MMU>();
   m_MMU->initialize(m_simBase);
 
+#ifndef USING_SST
+  // resume from a checkpoint
+  m_checkpoint->restore();
+#endif
+
   // open traces
   string trace_name_list = static_cast<string>(*KNOB(KNOB_TRACE_NAME_FILE));
   open_traces(trace_name_list);
 
+  // host-time profiler (simulation loop only)
+  if (*KNOB(KNOB_HOST_PROFILE)) m_host_profiler = new host_profiler_c(m_simBase);
+
   // any number other than 0, to pass the first simulation loop iteration
   m_num_running_core = 10000;
 }
@@ -782,46 +855,50 @@ void macsim_c::init_clock_domain(void) {
   CLOCK_MC = m_num_sim_cores + 2;
 
   m_clock_internal = 0;
-  float domain_f[5];
+  double domain_f[5];
   domain_f[0] = *KNOB(KNOB_CLOCK_CPU);
   domain_f[1] = *KNOB(KNOB_CLOCK_GPU);
   domain_f[2] = *KNOB(KNOB_CLOCK_LLC);
   domain_f[3] = *KNOB(KNOB_CLOCK_NOC);
   domain_f[4] = *KNOB(KNOB_CLOCK_MC);
 
-  // allow only .x format
-  for (int ii = 0; ii < 1; ++ii) {
-    bool found = false;
+  // scale frequencies to integers: allow up to .xxx format
+  //   a finer scale only makes the clock LCM larger; ticks in which no domain
+  //   runs are skipped (see skip_empty_ticks), so it costs no simulation time
+  //   knobs are floats, so a scaled value may be off by its representation error
+  double scale = 1.0;
+  for (int num_decimals = 0;; ++num_decimals) {
+    bool exact = true;
     for (int jj = 0; jj < 5; ++jj) {
-      int int_cast = static_cast<int>(domain_f[jj]);
-      float float_cast = static_cast<float>(int_cast);
-      if (domain_f[jj] != float_cast) {
-        found = true;
+      double scaled = domain_f[jj] * scale;
+      if (fabs(scaled - round(scaled)) > 1e-6 * scaled) {
+        exact = false;
         break;
       }
     }
 
-    if (found) {
-      for (int jj = 0; jj < 5; ++jj) {
-        domain_f[jj] *= 10;
-      }
-    } else {
-      break;
-    }
+    if (exact) break;
+
+    ASSERTM(num_decimals < 3,
+            "clock frequencies can have up to three decimal places\n");
+    scale *= 10;
+  }
+
+  for (int jj = 0; jj < 5; ++jj) {
+    domain_f[jj] = round(domain_f[jj] * scale);
   }
 
   m_domain_freq = new int[3 + m_num_sim_cores];
   m_domain_count = new int[3 + m_num_sim_cores];
-  m_domain_next = new int[3 + m_num_sim_cores];
+  m_domain_next = new Counter[3 + m_num_sim_cores];
 
   // Cores
   for (int ii = 0; ii < m_num_sim_cores; ++ii) {
     core_c* core = m_core_pointers[ii];
-    string core_type = core->get_core_type();
-    if (core_type == "ptx" || core_type == "nvbit") {
-      m_domain_freq[ii] = static_cast<int>(domain_f[CLOCK_GPU]);
+    if (core->is_nvidia_core()) {
+      m_domain_freq[ii] = static_cast<int>(round(domain_f[CLOCK_GPU]));
     } else {
-      m_domain_freq[ii] = static_cast<int>(domain_f[CLOCK_CPU]);
+      m_domain_freq[ii] = static_cast<int>(round(domain_f[CLOCK_CPU]));
     }
     m_domain_count[ii] = 0;
     m_domain_next[ii] = 0;
@@ -829,14 +906,19 @@ void macsim_c::init_clock_domain(void) {
 
   // LLC, NOC, MC
   for (int ii = 0; ii < 3; ++ii) {
-    m_domain_freq[ii + m_num_sim_cores] = static_cast<int>(domain_f[ii + 2]);
+    m_domain_freq[ii + m_num_sim_cores] =
+      static_cast<int>(round(domain_f[ii + 2]));
     m_domain_count[ii + m_num_sim_cores] = 0;
     m_domain_next[ii + m_num_sim_cores] = 0;
   }
 
+  // least common multiple of all domain frequencies
   m_clock_lcm = m_domain_freq[0];
   for (int i = 1; i < 3 + m_num_sim_cores; i++) {
-    m_clock_lcm = lcm(m_clock_lcm, m_domain_freq[i]);
+    Counter factor = m_domain_freq[i] / gcd(m_clock_lcm, m_domain_freq[i]);
+    ASSERTM(m_clock_lcm <= ULLONG_MAX / factor,
+            "clock LCM is too large for the clock frequencies\n");
+    m_clock_lcm *= factor;
   }
 
   report("Clock LCM           : " << m_clock_lcm);
@@ -847,10 +929,13 @@ void macsim_c::init_clock_domain(void) {
   report("MC  clock frequency : " << *KNOB(KNOB_CLOCK_MC) << " GHz");
 }
 
-#define GET_NEXT_CYCLE(domain)              \
-  ++m_domain_count[domain];                 \
-  m_domain_next[domain] = static_cast<int>( \
-    1.0 * m_clock_lcm * m_domain_count[domain] / m_domain_freq[domain]);
+// 128-bit product: exact for any frequency, including dyfr ones that do not
+// divide the clock LCM
+#define GET_NEXT_CYCLE(domain)                                             \
+  ++m_domain_count[domain];                                                \
+  m_domain_next[domain] = static_cast<Counter>(                            \
+    static_cast<unsigned __int128>(m_clock_lcm) * m_domain_count[domain] / \
+    m_domain_freq[domain]);
 
 // =======================================
 // Single cycle step of simulation state : returns running status
@@ -875,6 +960,21 @@ int macsim_c::run_a_cycle() {
     m_num_running_core = 0;
   }
 
+#ifndef USING_SST
+  // go to the next tick in which any clock domain runs
+  skip_empty_ticks();
+
+  // warm-state checkpoint at clock window boundaries
+  if (m_clock_internal == 0 && m_checkpoint->save_due()) {
+    m_checkpoint->save();
+    if (*KNOB(KNOB_CHECKPOINT_EXIT)) return 0;
+  }
+
+  // idle cycle skipping at clock window boundaries
+  if (m_clock_internal == 0 && KNOB_VALUE(KNOB_IDLE_CYCLE_SKIP))
+    skip_idle_windows();
+#endif
+
   Counter pivot = m_core_cycle[0] + 1;
 
   // Dynamic Frequency
@@ -890,21 +990,26 @@ int macsim_c::run_a_cycle() {
   }
 
   // update dyfr only after 1ms based on sampling period
-  int dyfr_sample_period = *KNOB(KNOB_DYFR_SAMPLE_PERIOD);
+  int dyfr_sample_period = KNOB_VALUE(KNOB_DYFR_SAMPLE_PERIOD);
   if (m_simulation_cycle > 10000000 &&
       m_simulation_cycle % dyfr_sample_period == 0) {
     m_dyfr->update();
   }
 
-  // handle page faults
-  m_MMU->handle_page_faults();
+  {
+    HOST_PROF_SCOPE(HOST_PROF_MMU);
 
-  // run memory management unit
-  m_MMU->run_a_cycle(pll_locked);
+    // handle page faults
+    m_MMU->handle_page_faults();
+
+    // run memory management unit
+    m_MMU->run_a_cycle(pll_locked);
+  }
 
 #ifndef USING_SST
   // interconnection
   if (m_clock_internal == m_domain_next[CLOCK_NOC]) {
+    HOST_PROF_SCOPE(HOST_PROF_NOC);
 #ifdef IRIS
     manifold::kernel::Manifold::Run((double)m_simulation_cycle);  // IRIS
     manifold::kernel::Manifold::Run(
@@ -917,12 +1022,14 @@ int macsim_c::run_a_cycle() {
 
   // run memory system
   if (m_clock_internal == m_domain_next[CLOCK_LLC]) {
+    HOST_PROF_SCOPE(HOST_PROF_MEMORY);
     m_memory->run_a_cycle(pll_locked);
     GET_NEXT_CYCLE(CLOCK_LLC);
   }
 
   // run dram controllers
   if (m_clock_internal == m_domain_next[CLOCK_MC]) {
+    HOST_PROF_SCOPE(HOST_PROF_DRAM);
     for (int ii = 0; ii < m_num_mc; ++ii) {
       m_dram_controller[ii]->run_a_cycle(pll_locked);
     }
@@ -936,7 +1043,6 @@ int macsim_c::run_a_cycle() {
     unsigned int ii = (kk + pivot) % m_num_sim_cores;
 
     core_c* core = m_core_pointers[ii];
-    string core_type = core->get_core_type();
     if (m_clock_internal != m_domain_next[ii]) {
       continue;
     } else {
@@ -952,7 +1058,10 @@ int macsim_c::run_a_cycle() {
     m_core_cycle[ii]++;
 
 #ifndef USING_SST
-    m_memory->run_a_cycle_core(ii, pll_locked);
+    {
+      HOST_PROF_SCOPE(HOST_PROF_MEMORY);
+      m_memory->run_a_cycle_core(ii, pll_locked);
+    }
 #endif
 
     // core ended or not started
@@ -983,20 +1092,23 @@ int macsim_c::run_a_cycle() {
     // checking for threads
     if (m_sim_end[ii] != true) {
       // when KNOB_MAX_INSTS is set, execute each thread for KNOB_MAX_INSTS instructions
-      if (*m_simBase->m_knobs->KNOB_MAX_INSTS &&
+      if (KNOB_VALUE(KNOB_MAX_INSTS) &&
           core->m_num_thread_reach_end == core->m_unique_scheduled_thread_num) {
         m_sim_end[ii] = true;
       }
       // when KNOB_SIM_CYCLE_COUNT is set, execute only KNOB_SIM_CYCLE_COUNT cycles
-      else if (*KNOB(KNOB_SIM_CYCLE_COUNT) &&
-               m_simulation_cycle >= *KNOB(KNOB_SIM_CYCLE_COUNT)) {
+      else if (KNOB_VALUE(KNOB_SIM_CYCLE_COUNT) &&
+               m_simulation_cycle >= KNOB_VALUE(KNOB_SIM_CYCLE_COUNT)) {
         m_sim_end[ii] = true;
       }
     }
 
     if (!m_sim_end[ii]) {
       // advance queues to prepare for the next cycle
-      core->advance_queues();
+      {
+        HOST_PROF_SCOPE(HOST_PROF_QUEUE);
+        core->advance_queues();
+      }
 
       // check heartbeat
       core->check_heartbeat(false);
@@ -1013,31 +1125,208 @@ int macsim_c::run_a_cycle() {
   m_simulation_cycle++;
   STAT_EVENT(CYC_COUNT_TOT);
 
+  if (m_stat_interval->due(m_simulation_cycle,
+                           (*m_ProcessorStats)[INST_COUNT_TOT].getCount()))
+    m_stat_interval->dump(m_simulation_cycle,
+                          (*m_ProcessorStats)[INST_COUNT_TOT].getCount());
+
   // m_termination_check[0] cpu [1] gpu
 
-  if (++m_clock_internal == m_clock_lcm) {
-    m_clock_internal = 0;
-    for (int ii = 0; ii < 3 + m_num_sim_cores; ++ii) {
-      m_domain_count[ii] = 0;
-      m_domain_next[ii] = 0;
+  if (++m_clock_internal == m_clock_lcm) end_clock_window();
+
+  return 1;  // simulation not finished
+}
+
+// =======================================
+// Start a new clock window
+// =======================================
+void macsim_c::end_clock_window(void) {
+  m_clock_internal = 0;
+  for (int ii = 0; ii < 3 + m_num_sim_cores; ++ii) {
+    m_domain_count[ii] = 0;
+    m_domain_next[ii] = 0;
+  }
+}
+
+// =======================================
+// Empty tick skipping
+// =======================================
+// with different clock frequencies, most internal ticks of a clock window run
+// no clock domain. such ticks only advance the clock, the MMU (idle) and
+// CYC_COUNT_TOT, so they are jumped over as a whole.
+void macsim_c::skip_empty_ticks(void) {
+  // the pll lockout and dyfr sampling count every tick
+  if (m_pll_lockout > 0 || KNOB_VALUE(KNOB_ENABLE_DYFR)) return;
+
+  Counter next_tick = m_clock_lcm;
+  for (int ii = 0; ii < 3 + m_num_sim_cores; ++ii) {
+    if (m_domain_next[ii] >= m_clock_internal)
+      next_tick = MIN2(next_tick, m_domain_next[ii]);
+  }
+
+  Counter num_ticks = next_tick - m_clock_internal;
+  if (num_ticks == 0) return;
+
+  num_ticks = MIN2(num_ticks, m_MMU->get_idle_cycles());
+
+  // interval snapshots are taken at the end of a tick
+  Counter next_snapshot = m_stat_interval->get_next_cycle();
+  if (next_snapshot) {
+    if (next_snapshot <= m_simulation_cycle + 1) return;
+    num_ticks = MIN2(num_ticks, next_snapshot - m_simulation_cycle - 1);
+  }
+
+  if (num_ticks == 0) return;
+
+  m_MMU->skip_cycles(num_ticks);
+  m_simulation_cycle += num_ticks;
+  STAT_EVENT_N(CYC_COUNT_TOT, num_ticks);
+
+  m_clock_internal += num_ticks;
+  if (m_clock_internal == m_clock_lcm) end_clock_window();
+}
+
+// =======================================
+// Idle cycle skipping
+// =======================================
+// count clock windows in which no component can change its state. each
+// component reports idle cycles in its own clock domain.
+Counter macsim_c::get_idle_windows(void) {
+  if (m_pll_lockout > 0 || KNOB_VALUE(KNOB_ENABLE_DYFR) ||
+      KNOB_VALUE(KNOB_ENABLE_IRIS) || !KNOB_VALUE(KNOB_ENABLE_NEW_NOC))
+    return 0;
+
+  Counter idle_windows = m_MMU->get_idle_cycles() / m_clock_lcm;
+  if (idle_windows == 0) return 0;
+
+  idle_windows = MIN2(idle_windows, m_network->get_idle_cycles() /
+                                      m_domain_freq[CLOCK_NOC]);
+  if (idle_windows == 0) return 0;
+
+  idle_windows = MIN2(idle_windows, m_memory->get_idle_cycles_uncore() /
+                                      m_domain_freq[CLOCK_LLC]);
+  if (idle_windows == 0) return 0;
+
+  for (int ii = 0; ii < m_num_mc; ++ii) {
+    idle_windows =
+      MIN2(idle_windows, m_dram_controller[ii]->get_idle_cycles() /
+                           m_domain_freq[CLOCK_MC]);
+    if (idle_windows == 0) return 0;
+  }
+
+  for (int ii = 0; ii < m_num_sim_cores; ++ii) {
+    core_c* core = m_core_pointers[ii];
+    Counter idle_cycles = m_memory->get_idle_cycles_core(ii);
+
+    // active core
+    if (!m_sim_end[ii] && m_core_started[ii]) {
+      // core is about to finish
+      if (m_core_end_trace[ii]) return 0;
+      if (core->m_running_thread_num == 0 &&
+          core->m_unique_scheduled_thread_num >= 1)
+        return 0;
+      if (KNOB_VALUE(KNOB_MAX_INSTS) &&
+          core->m_num_thread_reach_end == core->m_unique_scheduled_thread_num)
+        return 0;
+
+      idle_cycles = MIN2(idle_cycles, core->get_idle_cycles());
     }
+
+    idle_windows = MIN2(idle_windows, idle_cycles / m_domain_freq[ii]);
+    if (idle_windows == 0) return 0;
   }
 
-  return 1;  // simulation not finished
+  return idle_windows;
+}
+
+// the first idle window (probe) is simulated normally to measure the stats
+// updated in every cycle while idle. the following idle windows are skipped
+// by repeating the measured stat delta, so that all stats stay identical.
+void macsim_c::skip_idle_windows(void) {
+  if (!m_idle_probe) {
+    m_idle_windows = get_idle_windows();
+    if (m_idle_windows >= 2) {
+      m_ProcessorStats->getCounts(&m_idle_stat_base);
+      m_idle_probe = true;
+    }
+    return;
+  }
+
+  m_idle_probe = false;
+  Counter num_windows = MIN2(m_idle_windows - 1, get_idle_windows());
+
+  // stop at the end of simulation
+  if (KNOB_VALUE(KNOB_SIM_CYCLE_COUNT)) {
+    Counter sim_cycle_count = KNOB_VALUE(KNOB_SIM_CYCLE_COUNT);
+    if (m_simulation_cycle >= sim_cycle_count) return;
+    num_windows =
+      MIN2(num_windows, (sim_cycle_count - m_simulation_cycle) / m_clock_lcm);
+  }
+
+  // keep forward progress checks (every 10000 core cycles) at the same cycle
+  for (int ii = 0; ii < m_num_sim_cores; ++ii) {
+    Counter next_check = (m_core_cycle[ii] / 10000 + 1) * 10000;
+    num_windows = MIN2(num_windows, (next_check - m_core_cycle[ii] - 1) /
+                                      m_domain_freq[ii]);
+  }
+
+  if (num_windows == 0) return;
+
+  m_ProcessorStats->repeatDelta(m_idle_stat_base, num_windows);
+  advance_clock_windows(num_windows);
+
+  STAT_EVENT(IDLE_SKIP_COUNT);
+  STAT_EVENT_N(IDLE_SKIP_CYCLE, num_windows * m_clock_lcm);
+}
+
+void macsim_c::advance_clock_windows(Counter num_windows) {
+  for (int ii = 0; ii < m_num_sim_cores; ++ii) {
+    Counter num_cycles = num_windows * m_domain_freq[ii];
+    core_c* core = m_core_pointers[ii];
+
+    m_core_cycle[ii] += num_cycles;
+    core->inc_core_cycle_count(num_cycles);
+    if (!m_sim_end[ii] && m_core_started[ii]) core->skip_cycles(num_cycles);
+
+    m_memory->skip_cycles_core(ii, num_cycles);
+  }
+
+  m_memory->skip_cycles_uncore(num_windows * m_domain_freq[CLOCK_LLC]);
+  m_network->skip_cycles(num_windows * m_domain_freq[CLOCK_NOC]);
+  for (int ii = 0; ii < m_num_mc; ++ii)
+    m_dram_controller[ii]->skip_cycles(num_windows * m_domain_freq[CLOCK_MC]);
+  m_MMU->skip_cycles(num_windows * m_clock_lcm);
+
+  m_simulation_cycle += num_windows * m_clock_lcm;
 }
 
 // =======================================
 // Simulation end cleanup
 // =======================================
 void macsim_c::finalize() {
+  if (m_host_profiler) {
+    m_host_profiler->print();
+    delete m_host_profiler;
+    m_host_profiler = NULL;
+  }
+
   m_MMU->finalize();
 
+  // extrapolate the sampled windows before the cores are deallocated
+  m_sampler->finalize();
+
   // deallocate memory
   deallocate_memory();
 
   // finalize simulation
   fini_sim();
 
+  // last interval snapshot (same counts as the stat files)
+  m_stat_interval->finalize(m_simulation_cycle,
+                            (*m_ProcessorStats)[INST_COUNT_TOT].getCount());
+  delete m_stat_interval;
+  m_stat_interval = NULL;
+
   // dump out stat files at the end of simulation
   m_ProcessorStats->saveStats();
 
@@ -103,6 +103,31 @@ public:
    */
   void finalize();
 
+  /**
+   * Number of upcoming clock windows in which no component has work
+   */
+  Counter get_idle_windows(void);
+
+  /**
+   * Jump over idle clock windows (KNOB_IDLE_CYCLE_SKIP)
+   */
+  void skip_idle_windows(void);
+
+  /**
+   * Advance every clock domain by num_windows clock windows without running them
+   */
+  void advance_clock_windows(Counter num_windows);
+
+  /**
+   * Jump over internal clock ticks in which no clock domain runs
+   */
+  void skip_empty_ticks(void);
+
+  /**
+   * Start a new clock window once the internal clock reaches m_clock_lcm
+   */
+  void end_clock_window(void);
+
   /**
    * Init knob variables
    */
@@ -195,6 +220,8 @@ public:
 
 public:
   uint64_t m_hmc_trans_id_gen;
+  int m_drb_id_gen; /**< dram request buffer entry id generator */
+  int m_pref_id_gen; /**< hardware prefetcher id generator */
   int m_num_active_threads; /**< number of active threads */
   int
     m_num_waiting_dispatched_threads; /**< number of threads waiting for begin dispatched */
@@ -226,6 +253,7 @@ public:
   // knob variables
   KnobsContainer *m_knobsContainer; /**< knob container */
   all_knobs_c *m_knobs; /**< all knob variables */
+  all_knob_values_s *m_knob_values; /**< final knob values for hot paths */
 
   bool m_core_end_trace[MAX_NUM_CORES]; /**< core end trace flag */
   bool m_sim_end[MAX_NUM_CORES]; /**< core sim end flag */
@@ -249,8 +277,8 @@ public:
   // data structure pools (to reduce overhead of memory allocation)
   pool_c<thread_s> *m_thread_pool; /**<  thread data pool */
   pool_c<section_info_s> *m_section_pool; /**<  section data pool */
-  pool_c<mem_map_entry_c>
-    *m_mem_map_entry_pool; /**<  memory dependence data pool */
+  int m_mem_map_entries; /**< memory dependence entries in use */
+  int m_mem_map_max_entries; /**< high-water mark of m_mem_map_entries */
   pool_c<heartbeat_s> *m_heartbeat_pool; /**<  heartbeat data pool */
   pool_c<bp_recovery_info_c>
     *m_bp_recovery_info_pool; /**<  bp recovery information pool */
@@ -258,8 +286,8 @@ public:
   pool_c<uop_c> *m_uop_pool; /**<  uop pool */
   uop_c *m_invalid_uop; /**<  invalide uop pointer (for uop pool maintenance) */
 
-  unordered_map<int, hash_c<inst_info_s> *>
-    m_inst_info_hash; /**< decoded instruction map */
+  unordered_map<int, inst_info_cache_c *>
+    m_inst_info_hash; /**< decoded instruction cache per process */
   unordered_map<int, block_schedule_info_s *>
     m_block_schedule_info; /**< block schedule info */
   unordered_map<int, process_s *> m_sim_processes; /**< process map */
@@ -287,16 +315,25 @@ public:
 
 public:
   // clock handling
-  int m_clock_lcm; /**< main clock period */
+  Counter m_clock_lcm; /**< main clock period */
   int *m_domain_freq;
   int *m_domain_count;
-  int *m_domain_next;
-  int m_clock_internal; /**< internal macsim clock */
+  Counter *m_domain_next;
+  Counter m_clock_internal; /**< internal macsim clock */
   bool *m_termination_check; /**< termination checking logic */
   int m_termination_count;
 
   dyfr_c *m_dyfr; /**< dynamic frequency class> */
   unique_ptr<MMU> m_MMU; /**< memory management unit> */
+  checkpoint_c *m_checkpoint; /**< warm-state checkpoint */
+  sampler_c *m_sampler; /**< sampled simulation */
+  stat_interval_c *m_stat_interval; /**< interval statistics snapshots */
+  host_profiler_c *m_host_profiler; /**< host-time profiler (NULL: off) */
+
+  // host parallelism
+  trace_prefetcher_c *m_trace_prefetcher; /**< trace read-ahead (NULL: synchronous reads) */
+  trace_store_c *m_trace_store; /**< traces shared by sweep instances (NULL: private) */
+  int m_trace_store_user; /**< id of this instance in m_trace_store */
 
 private:
   macsim_c *m_simBase; /**< self-reference for macro usage */
@@ -316,6 +353,11 @@ private:
 
   int m_pll_lockout; /**< pll time counter to lock on a frequency */
 
+  // idle cycle skipping
+  bool m_idle_probe; /**< current clock window measures idle stats */
+  Counter m_idle_windows; /**< idle clock windows at the start of the probe */
+  vector<unsigned long long> m_idle_stat_base; /**< stats before the probe */
+
 #ifdef USING_SST
 #include "callback.h"
 public:
@@ -357,23 +399,15 @@ private:
 
 private:
   // Greatest common divisor
-  inline int gcd(int a, int b) {
+  inline Counter gcd(Counter a, Counter b) {
     do {
-      int tmp(b);
+      Counter tmp(b);
       b = a % b;
       a = tmp;
     } while (b != 0);
 
     return a;
   }
-
-  // Least common multiple of two integers
-  inline int lcm(const int &a, const int &b) {
-    int ret = a;
-    ret /= gcd(a, b);
-    ret *= b;
-    return ret;
-  }
 };
 
 #endif
@@ -37,10 +37,14 @@ POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 
 #include "macsim.h"
+#include "sweep.h"
 
 int main(int argc, char** argv) {
   macsim_c* sim;
 
+  // parameter sweep: many configurations in one process
+  if (sweep_requested(argc, argv)) return run_sweep(argc, argv);
+
   // Instantiate
   sim = new macsim_c();
 
@@ -44,6 +44,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "trace_read.h"
 #include "core.h"
 #include "map.h"
+#include "pool.h"
 #include "utils.h"
 
 #include "knob.h"
@@ -73,12 +74,127 @@ POSSIBILITY OF SUCH DAMAGE.
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
+// store dependence table constructor
+mem_map_table_c::mem_map_table_c(macsim_c *simBase) {
+  m_simBase = simBase;
+  m_num_slots = 64;
+  m_shift = 64 - 6;
+  m_size = 0;
+  m_keys = new Addr[m_num_slots];
+  m_entries = new mem_map_entry_c[m_num_slots];
+  for (int ii = 0; ii < m_num_slots; ++ii) m_keys[ii] = EMPTY_KEY;
+}
+
+// store dependence table destructor
+mem_map_table_c::~mem_map_table_c() {
+  delete[] m_keys;
+  delete[] m_entries;
+}
+
+// find the entry of a key
+mem_map_entry_c *mem_map_table_c::access(Addr key) {
+  for (int slot = get_slot(key);; slot = (slot + 1) & (m_num_slots - 1)) {
+    if (m_keys[slot] == key) return &m_entries[slot];
+    if (m_keys[slot] == EMPTY_KEY) return NULL;
+  }
+}
+
+// find the entry of a key, insert a new one if not found
+mem_map_entry_c *mem_map_table_c::access_create(Addr key, bool *new_entry) {
+  ASSERT(key != EMPTY_KEY);
+
+  int slot = get_slot(key);
+  for (;; slot = (slot + 1) & (m_num_slots - 1)) {
+    if (m_keys[slot] == key) {
+      *new_entry = false;
+      return &m_entries[slot];
+    }
+    if (m_keys[slot] == EMPTY_KEY) break;
+  }
+
+  // keep the load factor at or below 1/2
+  if ((m_size + 1) * 2 > m_num_slots) {
+    grow();
+    for (slot = get_slot(key); m_keys[slot] != EMPTY_KEY;
+         slot = (slot + 1) & (m_num_slots - 1))
+      ;
+  }
+
+  m_keys[slot] = key;
+  ++m_size;
+  *new_entry = true;
+
+  if (++m_simBase->m_mem_map_entries > m_simBase->m_mem_map_max_entries)
+    m_simBase->m_mem_map_max_entries = m_simBase->m_mem_map_entries;
+
+  return &m_entries[slot];
+}
+
+// remove the entry of a key
+//   following entries of the probe sequence are shifted back, so no tombstone is needed
+void mem_map_table_c::remove(Addr key) {
+  int slot = get_slot(key);
+  for (; m_keys[slot] != key; slot = (slot + 1) & (m_num_slots - 1)) {
+    if (m_keys[slot] == EMPTY_KEY) return;
+  }
+
+  int hole = slot;
+  for (int next = (hole + 1) & (m_num_slots - 1); m_keys[next] != EMPTY_KEY;
+       next = (next + 1) & (m_num_slots - 1)) {
+    // an entry can fill the hole if its home slot is not in (hole, next]
+    int home = get_slot(m_keys[next]);
+    if (((next - home) & (m_num_slots - 1)) >=
+        ((next - hole) & (m_num_slots - 1))) {
+      m_keys[hole] = m_keys[next];
+      m_entries[hole] = m_entries[next];
+      hole = next;
+    }
+  }
+  m_keys[hole] = EMPTY_KEY;
+
+  --m_size;
+  --m_simBase->m_mem_map_entries;
+}
+
+// remove all entries
+void mem_map_table_c::clear() {
+  if (m_size == 0) return;
+
+  for (int ii = 0; ii < m_num_slots; ++ii) m_keys[ii] = EMPTY_KEY;
+  m_simBase->m_mem_map_entries -= m_size;
+  m_size = 0;
+}
+
+// double the number of slots and re-insert all entries
+void mem_map_table_c::grow() {
+  int old_num_slots = m_num_slots;
+  Addr *old_keys = m_keys;
+  mem_map_entry_c *old_entries = m_entries;
+
+  m_num_slots *= 2;
+  --m_shift;
+  m_keys = new Addr[m_num_slots];
+  m_entries = new mem_map_entry_c[m_num_slots];
+  for (int ii = 0; ii < m_num_slots; ++ii) m_keys[ii] = EMPTY_KEY;
+
+  for (int ii = 0; ii < old_num_slots; ++ii) {
+    if (old_keys[ii] == EMPTY_KEY) continue;
+
+    int slot = get_slot(old_keys[ii]);
+    while (m_keys[slot] != EMPTY_KEY) slot = (slot + 1) & (m_num_slots - 1);
+    m_keys[slot] = old_keys[ii];
+    m_entries[slot] = old_entries[ii];
+  }
+
+  delete[] old_keys;
+  delete[] old_entries;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
 // map data constructor
-map_data_c::map_data_c(macsim_c *simBase) {
-  /* initialize the memory dependence hash table */
+map_data_c::map_data_c(macsim_c *simBase) : m_oracle_mem_table(simBase) {
   m_simBase = simBase;
-  m_oracle_mem_hash =
-    new hash_c<mem_map_entry_c>(simBase->m_mem_map_entry_pool);
 }
 
 // initialize map data
@@ -98,7 +214,7 @@ void map_data_c::initialize() {
 
   m_last_store_flag = false;
 
-  m_oracle_mem_hash->clear();
+  m_oracle_mem_table.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,12 +222,12 @@ void map_data_c::initialize() {
 // constructor
 map_c::map_c(macsim_c *simBase) {
   m_simBase = simBase;
-  m_core_map_data = new hash_c<map_data_c>("core_map_data");
+  m_map_data_pool = new pool_c<map_data_c>(4, "core_map_data");
 }
 
 // destructor
 map_c::~map_c() {
-  delete m_core_map_data;
+  delete m_map_data_pool;
 }
 
 // set source N not ready
@@ -227,14 +343,20 @@ void map_c::map_mem_dep(uop_c *uop) {
 }
 
 // delete entire dependence data for terminated thread
+//   the store dependence table is cleared here so that a terminated thread
+//   does not keep its entries until the data is reused
 void map_c::delete_map(int tid) {
-  m_core_map_data->hash_table_access_delete(tid);
+  map_data_c *map_data = get_map_data(tid);
+  if (map_data == NULL) return;
+
+  map_data->m_oracle_mem_table.clear();
+  m_map_data_pool->release_entry(map_data);
+  m_thread_map_data[tid] = NULL;
 }
 
 // update register dependence information (set destination register)
 void map_c::update_map(uop_c *uop) {
-  map_data_c *map_data;
-  map_data = m_core_map_data->hash_table_access(uop->m_thread_id);
+  map_data_c *map_data = get_map_data(uop->m_thread_id);
   ASSERT(NULL != map_data);
 
   // update the register map if the uop produces a value
@@ -278,14 +400,19 @@ void map_c::map_uop(uop_c *uop) {
 
 // read_reg_map: read and set srcs based on registers */
 void map_c::read_reg_map(uop_c *uop) {
-  map_data_c *map_data;
-  bool new_entry;
-  map_data = m_core_map_data->hash_table_access_create(uop->m_thread_id,
-                                                       &new_entry, m_simBase);
+  int tid = uop->m_thread_id;
+  ASSERT(tid >= 0);
 
-  ASSERT(NULL != map_data);
+  map_data_c *map_data = get_map_data(tid);
   // new entry
-  if (new_entry) map_data->initialize();
+  if (map_data == NULL) {
+    if (tid >= (int)m_thread_map_data.size())
+      m_thread_map_data.resize(tid + 1, NULL);
+
+    map_data = m_map_data_pool->acquire_entry(m_simBase);
+    map_data->initialize();
+    m_thread_map_data[tid] = map_data;
+  }
 
   for (int ii = 0; ii < uop->m_num_srcs; ++ii) {
     uns id = uop->m_src_info[ii];
@@ -307,8 +434,7 @@ void map_c::read_reg_map(uop_c *uop) {
 //  read_store_map: used to make mem ops dependent on the last store
 //   (no speculative loads)
 void map_c::read_store_map(uop_c *uop) {
-  map_data_c *map_data;
-  map_data = m_core_map_data->hash_table_access(uop->m_thread_id);
+  map_data_c *map_data = get_map_data(uop->m_thread_id);
   ASSERT(NULL != map_data);
   if (!*KNOB(KNOB_MEM_OBEY_STORE_DEP) || *KNOB(KNOB_MEM_OOO_STORES)) return;
 
@@ -338,19 +464,18 @@ void map_c::update_store_hash(uop_c *uop) {
   bool off_path = uop->m_off_path;
   Quad old_data = 0;
   bool new_entry = false;
-  map_data_c *map_data = m_core_map_data->hash_table_access(uop->m_thread_id);
+  map_data_c *map_data = get_map_data(uop->m_thread_id);
   ASSERT(NULL != map_data);
 
   // If using new_oracle, hash_table entry should have been created
   // in memory write function
   if (*m_simBase->m_knobs->KNOB_USE_NEW_ORACLE) {
     if (off_path && !MEM_GEN_OFF_PATH_VALS)
-      mem_map_p =
-        (map_data->m_oracle_mem_hash)
-          ->hash_table_access_create(MEM_MAP_KEY(va, off_path), &new_entry);
+      mem_map_p = map_data->m_oracle_mem_table.access_create(
+        MEM_MAP_KEY(va, off_path), &new_entry);
     else {
-      mem_map_p = (map_data->m_oracle_mem_hash)
-                    ->hash_table_access(MEM_MAP_KEY(va, off_path));
+      mem_map_p =
+        map_data->m_oracle_mem_table.access(MEM_MAP_KEY(va, off_path));
     }
 
     DEBUG_CORE(
@@ -360,9 +485,8 @@ void map_c::update_store_hash(uop_c *uop) {
       uop->m_core_id, uop->m_thread_id, first_byte, uop->m_uop_num,
       uop->m_inst_num, uop->m_mem_size, uop->m_vaddr, old_data, "XXX", "XXX");
   } else {
-    mem_map_p =
-      (map_data->m_oracle_mem_hash)
-        ->hash_table_access_create(MEM_MAP_KEY(va, off_path), &new_entry);
+    mem_map_p = map_data->m_oracle_mem_table.access_create(
+      MEM_MAP_KEY(va, off_path), &new_entry);
   }
 
   if (new_entry) {
@@ -397,11 +521,10 @@ uop_c *map_c::add_store_deps(uop_c *uop) {
   int first_byte = va & 0x7;
   bool off_path = uop->m_off_path;
   uop_c *src_uop = NULL;
-  map_data_c *map_data = m_core_map_data->hash_table_access(uop->m_thread_id);
+  map_data_c *map_data = get_map_data(uop->m_thread_id);
   ASSERT(NULL != map_data);
 
-  mem_map_p =
-    (map_data->m_oracle_mem_hash)->hash_table_access(MEM_MAP_KEY(va, off_path));
+  mem_map_p = map_data->m_oracle_mem_table.access(MEM_MAP_KEY(va, off_path));
 
   if (mem_map_p == NULL) {
     STAT_EVENT(LD_NO_FORWARD);
@@ -485,13 +608,13 @@ void map_c::delete_store_hash_entry(uop_c *uop) {
   Addr va = uop->m_vaddr;
   int first_byte = va & 0x7;
   bool off_path = uop->m_off_path;
-  map_data_c *map_data = m_core_map_data->hash_table_access(uop->m_thread_id);
+  map_data_c *map_data = get_map_data(uop->m_thread_id);
 
   if (map_data == NULL) return;
 
-  auto oracle_mem_hash = map_data->m_oracle_mem_hash;
+  mem_map_table_c *oracle_mem_table = &map_data->m_oracle_mem_table;
 
-  mem_map_p = oracle_mem_hash->hash_table_access(MEM_MAP_KEY(va, off_path));
+  mem_map_p = oracle_mem_table->access(MEM_MAP_KEY(va, off_path));
 
   if (!(mem_map_p && mem_map_p->m_uop[first_byte] == uop)) return;
 
@@ -506,7 +629,7 @@ void map_c::delete_store_hash_entry(uop_c *uop) {
   mem_map_p->m_uop[first_byte] = NULL;
 
   if (!mem_map_p->m_store_mask) {
-    oracle_mem_hash->hash_table_access_delete(MEM_MAP_KEY(va, off_path));
+    oracle_mem_table->remove(MEM_MAP_KEY(va, off_path));
   }
 }
 
@@ -38,6 +38,8 @@ POSSIBILITY OF SUCH DAMAGE.
 #ifndef MAP_H_INCLUDED
 #define MAP_H_INCLUDED
 
+#include <vector>
+
 #include "global_types.h"
 #include "global_defs.h"
 #include "utils.h"
@@ -70,6 +72,71 @@ public:
                        supplying a partial value to this map entry */
 };
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store dependence table of a thread
+///
+/// Open addressing (linear probing) table keyed by MEM_MAP_KEY with the entries stored
+/// inline. Entry pointers are valid until the next insertion or removal.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class mem_map_table_c
+{
+public:
+  /**
+   * Constructor
+   */
+  mem_map_table_c(macsim_c *simBase);
+
+  /**
+   * Destructor
+   */
+  ~mem_map_table_c();
+
+  /**
+   * Find the entry of a key, NULL if not found
+   */
+  mem_map_entry_c *access(Addr key);
+
+  /**
+   * Find the entry of a key. If not found, insert a new entry
+   */
+  mem_map_entry_c *access_create(Addr key, bool *new_entry);
+
+  /**
+   * Remove the entry of a key
+   */
+  void remove(Addr key);
+
+  /**
+   * Remove all entries
+   */
+  void clear();
+
+private:
+  mem_map_table_c();  // do not implement
+
+  /**
+   * Home slot of a key
+   */
+  int get_slot(Addr key) {
+    return (int)((key * 0x9E3779B97F4A7C15ULL) >> m_shift);
+  }
+
+  /**
+   * Double the number of slots
+   */
+  void grow();
+
+  static const Addr EMPTY_KEY = ~0ULL; /**< key of an empty slot */
+
+  int m_num_slots; /**< number of slots (power of 2) */
+  int m_shift; /**< 64 - log2(m_num_slots) */
+  int m_size; /**< number of entries */
+  Addr *m_keys; /**< slot keys */
+  mem_map_entry_c *m_entries; /**< slot entries */
+
+  macsim_c *m_simBase; /**< macsim_c base class for simulation globals */
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief data structure holding dependence information
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,7 +148,7 @@ public:
   map_entry_c m_last_store[2]; /**< last store map entry */
   bool m_last_store_flag; /**< last store flag */
 
-  hash_c<mem_map_entry_c> *m_oracle_mem_hash; /**< oracle memory hash */
+  mem_map_table_c m_oracle_mem_table; /**< oracle store dependence table */
 
   /**
    * Constructor
@@ -184,10 +251,18 @@ public:
    */
   void delete_map(int);
 
-public:
-  hash_c<map_data_c> *m_core_map_data; /**< per thread dependence table */
-
 private:
+  /**
+   * Dependence data of a thread, NULL if the thread has none
+   */
+  map_data_c *get_map_data(int tid) {
+    return (tid < (int)m_thread_map_data.size()) ? m_thread_map_data[tid]
+                                                 : NULL;
+  }
+
+  vector<map_data_c *> m_thread_map_data; /**< dependence data by thread id */
+  pool_c<map_data_c> *m_map_data_pool; /**< dependence data pool */
+
   macsim_c *m_simBase; /**< macsim_c base class for simulation globals */
 };
 
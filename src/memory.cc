@@ -39,6 +39,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "assert_macros.h"
 #include "cache.h"
+#include "checkpoint.h"
 #include "core.h"
 #include "debug_macros.h"
 #include "dram.h"
@@ -240,24 +241,27 @@ mem_req_s* queue_c::search(Addr addr, int size) {
 
 // search a request.
 bool queue_c::search(mem_req_s* req) {
-  for (auto I = m_entry.begin(), E = m_entry.end(); I != E; ++I) {
-    if ((*I) == req) return true;
-  }
-
-  return false;
+  return m_entry_pos.find(req) != m_entry_pos.end();
 }
 
 // delete an entry.
 void queue_c::pop(mem_req_s* req) {
-  m_entry.remove(req);
+  auto I = m_entry_pos.find(req);
+  if (I == m_entry_pos.end()) return;
+
+  m_entry.erase(I->second);
+  m_entry_pos.erase(I);
 }
 
 // insert en entry.
 bool queue_c::push(mem_req_s* req) {
   if (m_entry.size() == m_size) return false;
 
+  ASSERT(m_entry_pos.find(req) == m_entry_pos.end());
+
   req->m_queue = this;
-  m_entry.push_back(req);
+  m_entry_pos[req] = m_entry.insert(m_entry.end(), req);
+  // list::sort relinks the nodes, so the saved positions stay valid
   m_entry.sort(sort_func(m_simBase));
 
   return true;
@@ -396,7 +400,7 @@ mem_req_s* dcu_c::search_pref_in_queue() {
   }
 
   if (evict_req) {
-    m_in_queue->m_entry.remove(evict_req);
+    m_in_queue->pop(evict_req);
   }
 
   return evict_req;
@@ -707,6 +711,65 @@ void dcu_c::run_a_cycle(bool pll_lock) {
   ++m_cycle;
 }
 
+// a cache without queued requests does nothing until a new request arrives
+Counter dcu_c::get_idle_cycles(void) {
+  if (!m_retry_queue.empty() || !m_in_queue->m_entry.empty() ||
+      !m_out_queue->m_entry.empty() || !m_fill_queue->m_entry.empty() ||
+      !m_wb_queue->m_entry.empty())
+    return 0;
+
+  return ULLONG_MAX;
+}
+
+void dcu_c::skip_cycles(Counter num_cycles) {
+  m_cycle += num_cycles;
+}
+
+void dcu_c::save_checkpoint(checkpoint_c* ckpt) {
+  ckpt->write(m_disable);
+  if (!m_disable) m_cache->save_checkpoint(ckpt);
+}
+
+void dcu_c::restore_checkpoint(checkpoint_c* ckpt) {
+  ckpt->check(m_disable, "set of enabled cache levels");
+  if (!m_disable) m_cache->restore_checkpoint(ckpt);
+}
+
+// functional cache access for sampled simulation.
+// a dirty victim is dropped: the lower levels already hold the line
+bool dcu_c::warm(Addr addr, int core_id, int thread_id, int appl_id,
+                 bool store) {
+  if (m_disable) return false;
+
+  Addr line_addr, victim_line_addr;
+  dcache_data_s* line =
+    (dcache_data_s*)m_cache->access_cache(addr, &line_addr, true, appl_id);
+  bool cache_hit = (line) ? true : false;
+
+  if (!cache_hit) {
+    line = (dcache_data_s*)m_cache->insert_cache(
+      addr, &line_addr, &victim_line_addr, appl_id, m_acc_sim);
+    line->m_dirty = false;
+    line->m_fetch_cycle = m_cycle;
+    line->m_core_id = core_id;
+    line->m_pc = 0;
+    line->m_tid = thread_id;
+  }
+
+  if (store) line->m_dirty = true;
+
+  return cache_hit;
+}
+
+// the same path a miss takes: directly coupled cache or the next level over the NoC
+dcu_c* dcu_c::get_next_level(Addr addr) {
+  if (m_level == MEM_LLC) return NULL;
+
+  if (m_coupled_down) return m_next[m_next_id];
+
+  return m_memory->get_shared_cache(m_level + 1, addr);
+}
+
 // Main cache access function
 // process requests in the input queue
 // input queue:
@@ -1560,13 +1623,12 @@ void dcu_c::invalidate(Addr addr) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-int memory_c::m_unique_id = 0;
-
 // =======================================
 // memory_c constructor
 // =======================================
 memory_c::memory_c(macsim_c* simBase) {
   m_simBase = simBase;
+  m_unique_id = 0;
   REPORT("Memory system(%s) has been initialized.\n",
          KNOB(KNOB_MEMORY_TYPE)->getValue().c_str());
 
@@ -1665,6 +1727,7 @@ memory_c::memory_c(macsim_c* simBase) {
 
   // misc
   m_stop_prefetch = 0;
+  m_mshr_seq = 0;
   m_cycle = 0;
 
   if (*m_simBase->m_knobs->KNOB_DEFAULT_INTERLEAVING) {
@@ -1720,6 +1783,9 @@ memory_c::~memory_c() {
   delete[] m_l2_cache;
   delete[] m_l3_cache;
   delete[] m_llc_cache;
+
+  STAT_EVENT_N(POOL_MEM_REQ_MAX_IN_USE, m_mem_req_pool->get_max_in_use());
+  delete m_mem_req_pool;
 }
 
 // =======================================
@@ -1745,11 +1811,7 @@ bool memory_c::new_mem_req(Mem_Req_Type type, Addr addr, uns size,
 
   // find a matching request
   // search other cores' MSHRs as well since only L1s have MSHRs
-  mem_req_s* matching_req = NULL;
-  for (int i = 0; i < *KNOB(KNOB_NUM_SIM_CORES); ++i) {
-    matching_req = search_req(i, addr, size);
-    if (matching_req != NULL) break;
-  }
+  mem_req_s* matching_req = search_req(addr, size);
 
   if (type == MRT_IFETCH) {
     POWER_CORE_EVENT(core_id, POWER_ICACHE_MISS_BUF_R_TAG);
@@ -1844,6 +1906,7 @@ bool memory_c::new_mem_req(Mem_Req_Type type, Addr addr, uns size,
   // init new request
   init_new_req(new_req, type, addr, size, with_data, delay, uop, done_func,
                unique_num, priority, core_id, thread_id, ptx);
+  if (new_req->m_mshr_id != -1) mshr_index_insert(new_req);
 
   // merge to existing request
   if (ptx && *m_simBase->m_knobs->KNOB_COMPUTE_CAPABILITY == 2.0f &&
@@ -1882,22 +1945,75 @@ mem_req_s* memory_c::allocate_new_entry(int core_id) {
 
   mem_req_s* new_req = m_mshr_free_list[core_id].back();
   m_mshr_free_list[core_id].pop_back();
-  m_mshr[core_id].push_back(new_req);
+  new_req->m_mshr_pos = m_mshr[core_id].insert(m_mshr[core_id].end(), new_req);
+  new_req->m_mshr_id = core_id;
+  new_req->m_mshr_seq = m_mshr_seq++;
 
   return new_req;
 }
 
 // search matching request
-mem_req_s* memory_c::search_req(int core_id, Addr addr, int size) {
-  for (auto I = m_mshr[core_id].begin(), E = m_mshr[core_id].end(); I != E;
-       ++I) {
-    mem_req_s* req = (*I);
+// a request that covers at least one byte of the range is indexed under the block of addr;
+// only empty ranges need a full scan
+mem_req_s* memory_c::search_req(Addr addr, int size) {
+  int num_core = *KNOB(KNOB_NUM_SIM_CORES);
+
+  if (size <= 0) {
+    for (int ii = 0; ii < num_core; ++ii) {
+      for (auto I = m_mshr[ii].begin(), E = m_mshr[ii].end(); I != E; ++I) {
+        mem_req_s* req = (*I);
+        if (req->m_addr <= addr && req->m_addr + req->m_size >= addr + size) {
+          return req;
+        }
+      }
+    }
+    return NULL;
+  }
+
+  auto I = m_mshr_index.find(addr >> MSHR_INDEX_SHIFT);
+  if (I == m_mshr_index.end()) return NULL;
+
+  mem_req_s* result = NULL;
+  for (auto req : I->second) {
+    if (req->m_mshr_id >= num_core) continue;
     if (req->m_addr <= addr && req->m_addr + req->m_size >= addr + size) {
-      return req;
+      if (result == NULL || req->m_mshr_id < result->m_mshr_id ||
+          (req->m_mshr_id == result->m_mshr_id &&
+           req->m_mshr_seq < result->m_mshr_seq)) {
+        result = req;
+      }
     }
   }
 
-  return NULL;
+  return result;
+}
+
+// index an mshr request under every block it covers
+void memory_c::mshr_index_insert(mem_req_s* req) {
+  Addr first = req->m_addr >> MSHR_INDEX_SHIFT;
+  Addr last = req->m_size ? (req->m_addr + req->m_size - 1) >> MSHR_INDEX_SHIFT : first;
+  for (Addr block = first; block <= last; ++block) {
+    m_mshr_index[block].push_back(req);
+  }
+}
+
+// remove an mshr request from the index (must be called before its address changes)
+void memory_c::mshr_index_remove(mem_req_s* req) {
+  Addr first = req->m_addr >> MSHR_INDEX_SHIFT;
+  Addr last = req->m_size ? (req->m_addr + req->m_size - 1) >> MSHR_INDEX_SHIFT : first;
+  for (Addr block = first; block <= last; ++block) {
+    auto I = m_mshr_index.find(block);
+    ASSERT(I != m_mshr_index.end());
+
+    vector<mem_req_s*>& entries = I->second;
+    for (auto J = entries.begin(), E = entries.end(); J != E; ++J) {
+      if ((*J) == req) {
+        entries.erase(J);
+        break;
+      }
+    }
+    if (entries.empty()) m_mshr_index.erase(I);
+  }
 }
 
 // initialize a new request
@@ -1952,8 +2068,10 @@ void memory_c::adjust_req(mem_req_s* req, Mem_Req_Type type, Addr addr,
   req->m_block_id = 0;
   req->m_type = type;
   req->m_priority = priority;
+  mshr_index_remove(req);
   req->m_addr = addr;
   req->m_size = size;
+  mshr_index_insert(req);
   req->m_pc = uop ? uop->m_pc : 0;
   req->m_prefetcher_id = 0;
   req->m_pref_loadPC = 0;
@@ -2002,9 +2120,13 @@ void memory_c::free_req(int core_id, mem_req_s* req) {
   if (req->m_type == MRT_WB) {
     delete req;
   } else {
+    // a promoted prefetch may have taken the core id of another L1; the entry still
+    // belongs to the mshr it was allocated from
+    int mshr_id = req->m_mshr_id;
+    mshr_index_remove(req);
+    m_mshr[mshr_id].erase(req->m_mshr_pos);
     req->init();
-    m_mshr[core_id].remove(req);
-    m_mshr_free_list[core_id].push_back(req);
+    m_mshr_free_list[mshr_id].push_back(req);
   }
 }
 
@@ -2086,6 +2208,83 @@ void memory_c::run_a_cycle_uncore(bool pll_lock) {
     m_l3_cache[ii % m_num_l3]->run_a_cycle(pll_lock);
 }
 
+Counter memory_c::get_idle_cycles_core(int core_id) {
+  return MIN2(m_l2_cache[core_id]->get_idle_cycles(),
+              m_l1_cache[core_id]->get_idle_cycles());
+}
+
+Counter memory_c::get_idle_cycles_uncore(void) {
+  Counter idle_cycles = ULLONG_MAX;
+  for (int ii = 0; ii < m_num_llc; ++ii)
+    idle_cycles = MIN2(idle_cycles, m_llc_cache[ii]->get_idle_cycles());
+
+  for (int ii = 0; ii < m_num_l3; ++ii)
+    idle_cycles = MIN2(idle_cycles, m_l3_cache[ii]->get_idle_cycles());
+
+  return idle_cycles;
+}
+
+void memory_c::skip_cycles_core(int core_id, Counter num_cycles) {
+  m_l2_cache[core_id]->skip_cycles(num_cycles);
+  m_l1_cache[core_id]->skip_cycles(num_cycles);
+}
+
+void memory_c::skip_cycles_uncore(Counter num_cycles) {
+  for (int ii = 0; ii < m_num_llc; ++ii)
+    m_llc_cache[ii]->skip_cycles(num_cycles);
+
+  for (int ii = 0; ii < m_num_l3; ++ii) m_l3_cache[ii]->skip_cycles(num_cycles);
+
+  m_cycle += num_cycles;
+}
+
+void memory_c::save_checkpoint(checkpoint_c* ckpt) {
+  ckpt->write(m_num_core);
+  ckpt->write(m_num_l3);
+  ckpt->write(m_num_llc);
+
+  for (int ii = 0; ii < m_num_core; ++ii) {
+    m_l1_cache[ii]->save_checkpoint(ckpt);
+    m_l2_cache[ii]->save_checkpoint(ckpt);
+  }
+  for (int ii = 0; ii < m_num_l3; ++ii) m_l3_cache[ii]->save_checkpoint(ckpt);
+  for (int ii = 0; ii < m_num_llc; ++ii) m_llc_cache[ii]->save_checkpoint(ckpt);
+}
+
+void memory_c::restore_checkpoint(checkpoint_c* ckpt) {
+  ckpt->check(m_num_core, "number of L1/L2 caches");
+  ckpt->check(m_num_l3, "number of L3 caches");
+  ckpt->check(m_num_llc, "number of LLC caches");
+
+  for (int ii = 0; ii < m_num_core; ++ii) {
+    m_l1_cache[ii]->restore_checkpoint(ckpt);
+    m_l2_cache[ii]->restore_checkpoint(ckpt);
+  }
+  for (int ii = 0; ii < m_num_l3; ++ii) m_l3_cache[ii]->restore_checkpoint(ckpt);
+  for (int ii = 0; ii < m_num_llc; ++ii)
+    m_llc_cache[ii]->restore_checkpoint(ckpt);
+}
+
+// walk down the hierarchy until a level hits. a store dirties only the first level
+void memory_c::warm_cache(int core_id, int thread_id, int appl_id, Addr addr,
+                          bool store, int level) {
+  dcu_c* cache = (level == MEM_L1) ? m_l1_cache[core_id] : m_l2_cache[core_id];
+  while (cache != NULL) {
+    if (cache->warm(addr, core_id, thread_id, appl_id, store)) break;
+
+    store = false;
+    cache = cache->get_next_level(addr);
+  }
+}
+
+// same interleaving as set_cache_id()
+dcu_c* memory_c::get_shared_cache(int level, Addr addr) {
+  if (level == MEM_L3 && m_num_l3 > 0)
+    return m_l3_cache[BANK(addr, m_num_l3, m_l3_interleave_factor)];
+
+  return m_llc_cache[BANK(addr, m_num_llc, m_llc_interleave_factor)];
+}
+
 // evict a prefetch request
 mem_req_s* memory_c::evict_prefetch(int core_id) {
   mem_req_s* evict = m_l2_cache[core_id]->search_pref_in_queue();
@@ -38,6 +38,8 @@ POSSIBILITY OF SUCH DAMAGE.
 #define MEMORY_H
 
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
 #include "memreq_info.h"
 #include "pref_common.h"
@@ -47,6 +49,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #define MemType_Prefetch(x) (x >= MEM_SWPREF_NTA && x <= MEM_SWPREF_T2)
 #define MRT_Prefetch(x) (x >= MRT_SW_DPRF && x <= MRT_SW_DPRF_T2)
 
+// mshr entries are indexed by every 64B block they cover
+#define MSHR_INDEX_SHIFT 6
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
 enum COHERENCE_STATE {
@@ -132,6 +137,8 @@ public:
   list<mem_req_s*> m_entry; /**< queue entries */
 
 private:
+  unordered_map<mem_req_s*, list<mem_req_s*>::iterator>
+    m_entry_pos; /**< position of each entry for constant-time pop */
   unsigned int m_size; /**< queue size */
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
 };
@@ -216,6 +223,37 @@ public:
    */
   void run_a_cycle(bool);
 
+  /**
+   * Number of upcoming cycles without any work (0: busy)
+   */
+  Counter get_idle_cycles(void);
+
+  /**
+   * Advance the clock without running idle cycles
+   */
+  void skip_cycles(Counter num_cycles);
+
+  /**
+   * Save cache contents to a checkpoint
+   */
+  void save_checkpoint(checkpoint_c* ckpt);
+
+  /**
+   * Load cache contents from a checkpoint
+   */
+  void restore_checkpoint(checkpoint_c* ckpt);
+
+  /**
+   * Sampled simulation : functional access that allocates the line on a miss
+   * @return true on a hit (a disabled cache always misses)
+   */
+  bool warm(Addr addr, int core_id, int thread_id, int appl_id, bool store);
+
+  /**
+   * Next-level cache that a miss of the given address is sent to (NULL: memory)
+   */
+  dcu_c* get_next_level(Addr addr);
+
   /**
    * Check available buffer space
    */
@@ -407,6 +445,48 @@ public:
    */
   void run_a_cycle_uncore(bool);
 
+  /**
+   * Number of upcoming cycles without any work in L1/L2 caches of a core
+   */
+  Counter get_idle_cycles_core(int core_id);
+
+  /**
+   * Number of upcoming cycles without any work in shared caches
+   */
+  Counter get_idle_cycles_uncore(void);
+
+  /**
+   * Advance the clock of L1/L2 caches of a core without running idle cycles
+   */
+  void skip_cycles_core(int core_id, Counter num_cycles);
+
+  /**
+   * Advance the clock of shared caches without running idle cycles
+   */
+  void skip_cycles_uncore(Counter num_cycles);
+
+  /**
+   * Save the contents of all caches to a checkpoint
+   */
+  void save_checkpoint(checkpoint_c* ckpt);
+
+  /**
+   * Load the contents of all caches from a checkpoint (requests in flight are not saved)
+   */
+  void restore_checkpoint(checkpoint_c* ckpt);
+
+  /**
+   * Sampled simulation : functional access from the given level down to the LLC. Every
+   * level that misses allocates the line; no request, timing or stat is generated
+   */
+  void warm_cache(int core_id, int thread_id, int appl_id, Addr addr, bool store,
+                  int level);
+
+  /**
+   * Shared cache (MEM_L3 or MEM_LLC) that holds the given address
+   */
+  dcu_c* get_shared_cache(int level, Addr addr);
+
   /**
    * Deallocate completed memory request
    */
@@ -487,7 +567,7 @@ public:
   virtual void invalidate(Addr page_addr);
 
 public:
-  static int m_unique_id; /**< unique memory request id */
+  int m_unique_id; /**< unique memory request id */
 
   int* m_iris_node_id; /**< noc id for iris network nodes */
 
@@ -515,9 +595,20 @@ protected:
                   int thread_id, bool ptx);
 
   /**
-   * Search a request from queues
+   * Search an mshr request that covers [addr, addr + size). When several requests match,
+   * the oldest one of the lowest L1 is returned.
+   */
+  mem_req_s* search_req(Addr addr, int size);
+
+  /**
+   * Add an mshr request to the address index
+   */
+  void mshr_index_insert(mem_req_s* req);
+
+  /**
+   * Remove an mshr request from the address index
    */
-  mem_req_s* search_req(int core_id, Addr addr, int size);
+  void mshr_index_remove(mem_req_s* req);
 
   /**
    * Set the level of each cache level
@@ -541,6 +632,9 @@ protected:
   dcu_c** m_llc_cache; /**< LLC caches */
   list<mem_req_s*>* m_mshr; /**< mshr entry per L1 cache */
   list<mem_req_s*>* m_mshr_free_list; /**< mshr entry free list */
+  unordered_map<Addr, vector<mem_req_s*>>
+    m_mshr_index; /**< mshr entries of all L1s by 64B block */
+  Counter m_mshr_seq; /**< mshr allocation counter */
   int m_num_core; /**< number of cores */
   int m_num_cpu;
   int m_num_gpu;
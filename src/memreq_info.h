@@ -167,6 +167,9 @@ typedef struct mem_req_s {
   int m_msg_dst; /**< destination node id */
   int m_bypass; /**< bypass last level cache */
   bool m_skip; /**< llc skip bit */
+  int m_mshr_id; /**< L1 whose mshr holds this request (-1 if none) */
+  Counter m_mshr_seq; /**< mshr allocation order */
+  list<mem_req_s*>::iterator m_mshr_pos; /**< position in the mshr list */
   int m_noc_type; /**< noc request type: req or reply */
   Counter m_noc_cycle; /**< noc start cycle */
   macsim_c* m_simBase; /**< reference to macsim base class for sim globals */
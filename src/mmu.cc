@@ -57,6 +57,7 @@ POSSIBILITY OF SUCH DAMAGE.
 /* macsim */
 #include "all_knobs.h"
 #include "assert_macros.h"
+#include "checkpoint.h"
 #include "core.h"
 #include "debug_macros.h"
 #include "frontend.h"
@@ -114,6 +115,20 @@ Addr MMU::ReplacementUnit::getVictim() {
   return page_number;
 }
 
+void MMU::ReplacementUnit::save_checkpoint(checkpoint_c *ckpt) {
+  ckpt->write<uint64_t>(m_table.size());
+  for (Entry *node = m_head->next; node != m_tail; node = node->next)
+    ckpt->write(node->page_number);
+}
+
+void MMU::ReplacementUnit::restore_checkpoint(checkpoint_c *ckpt) {
+  vector<Addr> pages(ckpt->read<uint64_t>());
+  for (auto &page : pages) page = ckpt->read<Addr>();
+
+  // insert from the LRU position so that the MRU page ends up at the head
+  for (auto I = pages.rbegin(), E = pages.rend(); I != E; ++I) insert(*I);
+}
+
 void MMU::initialize(macsim_c *simBase) {
   m_simBase = simBase;
 
@@ -150,6 +165,53 @@ void MMU::finalize() {
   STAT_EVENT_N(UNIQUE_PAGE, m_unique_pages.size());
 }
 
+void MMU::save_checkpoint(checkpoint_c *ckpt) {
+  ckpt->write(m_page_size);
+  ckpt->write(m_memory_size);
+
+  ckpt->write<uint64_t>(m_page_table.size());
+  for (auto &entry : m_page_table) {
+    ckpt->write(entry.first);
+    ckpt->write(entry.second.frame_number);
+  }
+
+  // allocated frames
+  ckpt->write(m_frame_to_allocate);
+  ckpt->write(m_free_frames_remaining);
+  for (size_t frame = 0; frame < m_free_frames.size(); ++frame)
+    if (!m_free_frames[frame]) ckpt->write<uint64_t>(frame);
+
+  m_replacement_unit->save_checkpoint(ckpt);
+  m_TLB->save_checkpoint(ckpt);
+
+  ckpt->write<uint64_t>(m_unique_pages.size());
+  for (auto page : m_unique_pages) ckpt->write(page);
+}
+
+void MMU::restore_checkpoint(checkpoint_c *ckpt) {
+  ckpt->check(m_page_size, "page size");
+  ckpt->check(m_memory_size, "memory size");
+
+  uint64_t num_pages = ckpt->read<uint64_t>();
+  for (uint64_t ii = 0; ii < num_pages; ++ii) {
+    Addr page_number = ckpt->read<Addr>();
+    m_page_table.emplace(page_number, PageDescriptor(ckpt->read<Addr>()));
+  }
+
+  m_frame_to_allocate = ckpt->read<Addr>();
+  m_free_frames_remaining = ckpt->read<long>();
+  long num_frames = m_free_frames.size() - m_free_frames_remaining;
+  for (long ii = 0; ii < num_frames; ++ii)
+    m_free_frames[ckpt->read<uint64_t>()] = false;
+
+  m_replacement_unit->restore_checkpoint(ckpt);
+  m_TLB->restore_checkpoint(ckpt);
+
+  uint64_t num_unique_pages = ckpt->read<uint64_t>();
+  for (uint64_t ii = 0; ii < num_unique_pages; ++ii)
+    m_unique_pages.insert(ckpt->read<Addr>());
+}
+
 bool MMU::translate(uop_c *cur_uop) {
   if (cur_uop->m_translated) return true;
 
@@ -300,6 +362,23 @@ void MMU::run_a_cycle(bool pll_lock) {
   ++m_cycle;
 }
 
+// number of upcoming cycles in which run_a_cycle() and handle_page_faults()
+// only advance the clock
+Counter MMU::get_idle_cycles(void) {
+  if (m_batch_processing || !m_fault_buffer.empty() || !m_retry_queue.empty() ||
+      !m_fault_retry_queue.empty())
+    return 0;
+
+  if (m_walk_queue_cycle.empty()) return ULLONG_MAX;
+
+  Counter next_walk = m_walk_queue_cycle.begin()->first;
+  return (next_walk > m_cycle) ? next_walk - m_cycle : 0;
+}
+
+void MMU::skip_cycles(Counter num_cycles) {
+  m_cycle += num_cycles;
+}
+
 void MMU::do_page_table_walks(uop_c *cur_uop) {
   Addr addr = cur_uop->m_vaddr;
   Addr page_number = get_page_number(addr);
@@ -91,6 +91,10 @@ private:
     void update(Addr page_number);
     Addr getVictim();
 
+    // pages from MRU to LRU position
+    void save_checkpoint(checkpoint_c *ckpt);
+    void restore_checkpoint(checkpoint_c *ckpt);
+
   private:
     struct Entry {
       Addr page_number;
@@ -133,6 +137,14 @@ public:
   bool translate(uop_c *cur_uop);
   void handle_page_faults();
 
+  // idle cycle skipping: cycles without any work / advance the clock
+  Counter get_idle_cycles(void);
+  void skip_cycles(Counter num_cycles);
+
+  // checkpoint: page table, frame allocation and TLB (page walks in flight are dropped)
+  void save_checkpoint(checkpoint_c *ckpt);
+  void restore_checkpoint(checkpoint_c *ckpt);
+
 private:
   void do_page_table_walks(uop_c *cur_uop);
 
@@ -49,9 +49,6 @@ POSSIBILITY OF SUCH DAMAGE.
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-int g_total_packet = 0;
-int g_total_cpu_packet = 0;
-int g_total_gpu_packet = 0;
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -109,13 +106,24 @@ network_c::network_c(macsim_c* simBase) {
   m_simBase = simBase;
 
   m_total_packet = 0;
+  m_total_cpu_packet = 0;
+  m_total_gpu_packet = 0;
   m_num_router = 0;
+  m_cycle = 0;
 
   m_flit_pool = new pool_c<flit_c>(100, "flit");
   m_credit_pool = new pool_c<credit_c>(100, "credit");
 }
 
 network_c::~network_c() {
+  // pool high-water marks and heap allocations
+  STAT_EVENT_N(POOL_FLIT_MAX_IN_USE, m_flit_pool->get_max_in_use());
+  STAT_EVENT_N(POOL_CREDIT_MAX_IN_USE, m_credit_pool->get_max_in_use());
+  STAT_EVENT_N(NOC_FLIT_ALLOC, m_flit_pool->size());
+  STAT_EVENT_N(NOC_CREDIT_ALLOC, m_credit_pool->size());
+  for (int ii = 0; ii < m_num_router; ++ii)
+    STAT_EVENT_N(NOC_QUEUE_EXPAND, m_router[ii]->get_num_queue_expand());
+
   delete m_flit_pool;
   delete m_credit_pool;
 }
@@ -141,6 +149,60 @@ void network_c::receive_pop(int level, int id) {
   return m_router[m_router_map[level * 1000 + id]]->pop_req(0);
 }
 
+// the network has no timed event of its own: it is idle while empty
+Counter network_c::get_idle_cycles(void) {
+  for (int ii = 0; ii < m_num_router; ++ii) {
+    if (!m_router[ii]->is_idle()) return 0;
+  }
+
+  return ULLONG_MAX;
+}
+
+void network_c::skip_cycles(Counter num_cycles) {
+  for (int ii = 0; ii < m_num_router; ++ii)
+    m_router[ii]->skip_cycles(num_cycles);
+
+  m_cycle += num_cycles;
+}
+
+void network_c::init_active_routers(void) {
+  m_active_router.assign((m_num_router + 63) / 64, 0);
+  for (int ii = 0; ii < m_num_router; ++ii)
+    m_router[ii]->set_active_router(&m_active_router, ii);
+}
+
+// tick the routers with work in the order CYCLE % n, ..., n - 1, 0, ..., CYCLE % n - 1.
+// ticking a router without work only advances its clock, so it is skipped. a router
+// woken up by a router earlier in the order is ticked in the same cycle, as before.
+void network_c::run_active_routers(bool pll_lock) {
+  int index = CYCLE % m_num_router;
+  for (int pass = 0; pass < 2; ++pass) {
+    int begin = (pass == 0) ? index : 0;
+    int end = (pass == 0) ? m_num_router : index;
+    for (int ii = next_active_router(begin, end); ii < end;
+         ii = next_active_router(ii + 1, end)) {
+      router_c* router = m_router[ii];
+      router->sync_cycle(m_cycle);
+      router->run_a_cycle(pll_lock);
+      if (!router->has_work())
+        m_active_router[ii >> 6] &= ~(1ULL << (ii & 63));
+    }
+  }
+}
+
+int network_c::next_active_router(int from, int end) {
+  while (from < end) {
+    uint64_t word = m_active_router[from >> 6] >> (from & 63);
+    if (word) {
+      int ii = from + __builtin_ctzll(word);
+      return (ii < end) ? ii : end;
+    }
+    from = (from | 63) + 1;
+  }
+
+  return end;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 router_c::router_c(macsim_c* simBase, int type, int id, int num_port)
@@ -161,13 +223,17 @@ router_c::router_c(macsim_c* simBase, int type, int id, int num_port)
   m_opposite_dir[DOWN] = UP;
 
   // memory allocations
-  m_req_buffer = new queue<mem_req_s*>;
+  m_buffer_max_size = 10;
+
+  m_req_buffer = new ring_queue_c<mem_req_s*>;
+  m_req_buffer->reserve(m_buffer_max_size);
 
-  m_injection_buffer = new list<mem_req_s*>;
+  m_injection_buffer = new ring_queue_c<mem_req_s*>;
   m_injection_buffer_max_size = 32;
+  m_injection_buffer->reserve(m_injection_buffer_max_size);
 
-  m_input_buffer = new list<flit_c*>*[m_num_port];
-  m_output_buffer = new list<flit_c*>*[m_num_port];
+  m_input_buffer = new ring_queue_c<flit_c*>*[m_num_port];
+  m_output_buffer = new ring_queue_c<flit_c*>*[m_num_port];
   m_route = new bool***[m_num_port];
   m_route_fixed = new int*[m_num_port];
   m_output_vc_avail = new bool*[m_num_port];
@@ -176,8 +242,12 @@ router_c::router_c(macsim_c* simBase, int type, int id, int num_port)
   m_credit = new int*[m_num_port];
 
   for (int ii = 0; ii < m_num_port; ++ii) {
-    m_input_buffer[ii] = new list<flit_c*>[m_num_vc];
-    m_output_buffer[ii] = new list<flit_c*>[m_num_vc];
+    m_input_buffer[ii] = new ring_queue_c<flit_c*>[m_num_vc];
+    m_output_buffer[ii] = new ring_queue_c<flit_c*>[m_num_vc];
+    for (int jj = 0; jj < m_num_vc; ++jj) {
+      m_input_buffer[ii][jj].reserve(m_buffer_max_size);
+      m_output_buffer[ii][jj].reserve(m_buffer_max_size);
+    }
     m_route_fixed[ii] = new int[m_num_vc];
     fill_n(m_route_fixed[ii], m_num_vc, -1);
     m_route[ii] = new bool**[m_num_vc];
@@ -203,8 +273,6 @@ router_c::router_c(macsim_c* simBase, int type, int id, int num_port)
     fill_n(m_credit[ii], m_num_vc, 10);
   }
 
-  m_buffer_max_size = 10;
-
   // switch
   m_sw_avail = new Counter[m_num_port];
   fill_n(m_sw_avail, m_num_port, 0);
@@ -212,7 +280,13 @@ router_c::router_c(macsim_c* simBase, int type, int id, int num_port)
   m_link_avail = new Counter[m_num_port];
   fill_n(m_link_avail, m_num_port, 0);
 
-  m_pending_credit = new list<credit_c*>;
+  m_pending_credit = new ring_queue_c<credit_c*>;
+  m_pending_credit->reserve(m_num_port * m_num_vc);
+
+  m_active_router = NULL;
+  m_router_index = -1;
+
+  m_cycle = 0;
 }
 
 router_c::~router_c() {
@@ -280,6 +354,7 @@ void router_c::run_a_cycle(bool pll_lock) {
 bool router_c::inject_packet(mem_req_s* req) {
   if (m_injection_buffer->size() < m_injection_buffer_max_size) {
     m_injection_buffer->push_back(req);
+    wake();
     return true;
   }
 
@@ -323,19 +398,19 @@ void router_c::local_packet_injection(void) {
         req->m_noc_cycle = m_cycle;
 
         // stat handling
-        ++g_total_packet;
+        ++(*m_total_packet);
         if (req->m_acc) {
-          ++g_total_gpu_packet;
+          ++(*m_total_gpu_packet);
           STAT_EVENT(NOC_AVG_ACTIVE_PACKET_BASE_GPU);
-          STAT_EVENT_N(NOC_AVG_ACTIVE_PACKET_GPU, g_total_gpu_packet);
+          STAT_EVENT_N(NOC_AVG_ACTIVE_PACKET_GPU, *m_total_gpu_packet);
         } else {
-          ++g_total_cpu_packet;
+          ++(*m_total_cpu_packet);
           STAT_EVENT(NOC_AVG_ACTIVE_PACKET_BASE_CPU);
-          STAT_EVENT_N(NOC_AVG_ACTIVE_PACKET_CPU, g_total_cpu_packet);
+          STAT_EVENT_N(NOC_AVG_ACTIVE_PACKET_CPU, *m_total_cpu_packet);
         }
 
         STAT_EVENT(NOC_AVG_ACTIVE_PACKET_BASE);
-        STAT_EVENT_N(NOC_AVG_ACTIVE_PACKET, g_total_packet);
+        STAT_EVENT_N(NOC_AVG_ACTIVE_PACKET, *m_total_packet);
 
         // packet generation
         for (int jj = 0; jj < num_flit; ++jj) {
@@ -424,7 +499,7 @@ void router_c::stage_vca(void) {
         // free 1) switch, 2) ivc_avail[ip][ivc], 3) rc, 4) vc
         if (flit->m_tail) {
           if (port == LOCAL) {
-            m_req_buffer->push(flit->m_req);
+            m_req_buffer->push_back(flit->m_req);
           }
         }
 
@@ -651,13 +726,13 @@ void router_c::stage_lt(void) {
         m_output_vc_avail[port][vc] = true;
 
         if (port == LOCAL) {
-          --g_total_packet;
+          --(*m_total_packet);
           if (f->m_req->m_acc) {
-            --g_total_gpu_packet;
+            --(*m_total_gpu_packet);
           } else {
-            --g_total_cpu_packet;
+            --(*m_total_cpu_packet);
           }
-          m_req_buffer->push(f->m_req);
+          m_req_buffer->push_back(f->m_req);
           DEBUG(
             "cycle:%-10lld node:%d [TT] req_id:%d flit_id:%d src:%d dst:%d "
             "vc:%d\n",
@@ -684,6 +759,55 @@ void router_c::stage_lt(void) {
 void router_c::check_channel(void) {
 }
 
+bool router_c::is_idle(void) {
+  return m_req_buffer->empty() && !has_work();
+}
+
+void router_c::skip_cycles(Counter num_cycles) {
+  m_cycle += num_cycles;
+}
+
+int router_c::get_num_queue_expand(void) {
+  int num_expand = m_injection_buffer->get_num_expand() +
+                   m_req_buffer->get_num_expand() +
+                   m_pending_credit->get_num_expand();
+  for (int ii = 0; ii < m_num_port; ++ii) {
+    for (int jj = 0; jj < m_num_vc; ++jj) {
+      num_expand += m_input_buffer[ii][jj].get_num_expand() +
+                    m_output_buffer[ii][jj].get_num_expand();
+    }
+  }
+
+  return num_expand;
+}
+
+bool router_c::has_work(void) {
+  if (!m_injection_buffer->empty() || !m_pending_credit->empty()) return true;
+
+  for (int ii = 0; ii < m_num_port; ++ii) {
+    for (int jj = 0; jj < m_num_vc; ++jj) {
+      if (!m_input_buffer[ii][jj].empty() || !m_output_buffer[ii][jj].empty())
+        return true;
+    }
+  }
+
+  return false;
+}
+
+void router_c::set_active_router(vector<uint64_t>* active_router, int index) {
+  m_active_router = active_router;
+  m_router_index = index;
+}
+
+void router_c::wake(void) {
+  if (m_active_router)
+    (*m_active_router)[m_router_index >> 6] |= 1ULL << (m_router_index & 63);
+}
+
+void router_c::sync_cycle(Counter cycle) {
+  m_cycle = cycle;
+}
+
 void router_c::insert_packet(flit_c* flit, int port, int vc) {
   // IB (Input Buffering) stage
   if (flit->m_head)
@@ -693,29 +817,31 @@ void router_c::insert_packet(flit_c* flit, int port, int vc) {
 
   m_input_buffer[port][vc].push_back(flit);
   flit->m_state = IB;
+  wake();
 }
 
 void router_c::insert_packet(mem_req_s* req) {
-  m_req_buffer->push(req);
+  m_req_buffer->push_back(req);
 }
 
 void router_c::insert_credit(credit_c* credit) {
   m_pending_credit->push_back(credit);
+  wake();
 }
 
+// ready credits are removed, the others keep their order
 void router_c::process_pending_credit(void) {
-  if (m_pending_credit->empty()) return;
-
-  auto I = m_pending_credit->begin();
-  auto E = m_pending_credit->end();
-  do {
-    credit_c* credit = (*I++);
+  int num_credit = m_pending_credit->size();
+  for (int ii = 0; ii < num_credit; ++ii) {
+    credit_c* credit = m_pending_credit->front();
+    m_pending_credit->pop_front();
     if (credit->m_rdy_cycle <= CYCLE) {
       ++m_credit[credit->m_port][credit->m_vc];
-      m_pending_credit->remove(credit);
       m_credit_pool->release_entry(credit);
+    } else {
+      m_pending_credit->push_back(credit);
     }
-  } while (I != E);
+  }
 }
 
 mem_req_s* router_c::receive_req(int dir) {
@@ -726,13 +852,16 @@ mem_req_s* router_c::receive_req(int dir) {
 }
 
 void router_c::pop_req(int dir) {
-  m_req_buffer->pop();
+  m_req_buffer->pop_front();
 }
 
-void router_c::init(int total_router, int* total_packet,
-                    pool_c<flit_c>* flit_pool, pool_c<credit_c>* credit_pool) {
+void router_c::init(int total_router, int* total_packet, int* total_cpu_packet,
+                    int* total_gpu_packet, pool_c<flit_c>* flit_pool,
+                    pool_c<credit_c>* credit_pool) {
   m_total_router = total_router;
   m_total_packet = total_packet;
+  m_total_cpu_packet = total_cpu_packet;
+  m_total_gpu_packet = total_gpu_packet;
   m_flit_pool = flit_pool;
   m_credit_pool = credit_pool;
 }
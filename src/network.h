@@ -43,6 +43,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include <list>
 
 #include "macsim.h"
+#include "ring_queue.h"
 
 #define CPU_ROUTER 0
 #define GPU_ROUTER 1
@@ -150,8 +151,9 @@ public:
   virtual bool inject_packet(mem_req_s* req);
   virtual mem_req_s* receive_req(int dir);
   virtual void pop_req(int dir);
-  virtual void init(int total_router, int* total_packet,
-                    pool_c<flit_c>* flit_pool, pool_c<credit_c>* credit_pool);
+  virtual void init(int total_router, int* total_packet, int* total_cpu_packet,
+                    int* total_gpu_packet, pool_c<flit_c>* flit_pool,
+                    pool_c<credit_c>* credit_pool);
   virtual void set_link(int dir, router_c* link);
   virtual int get_id(void);
   virtual void set_id(int id);
@@ -162,6 +164,30 @@ public:
   virtual void insert_credit(credit_c*);
   virtual router_c* get_router(int dir);
 
+  // idle cycle skipping: no packet, flit or credit in the router
+  virtual bool is_idle(void);
+  virtual void skip_cycles(Counter num_cycles);
+
+  /**
+   * Register the router in the active router bitmap of the network
+   */
+  void set_active_router(vector<uint64_t>* active_router, int index);
+
+  /**
+   * Check whether the router has flits, credits or packets to inject
+   */
+  bool has_work(void);
+
+  /**
+   * Set the router clock (routers without work are not ticked)
+   */
+  void sync_cycle(Counter cycle);
+
+  /**
+   * Number of buffer expansions beyond the modeled buffer depth
+   */
+  int get_num_queue_expand(void);
+
   // these functions are currently used by only network_simple_c
   virtual void reset(void);
   virtual int* get_num_packet_inserted(void);
@@ -229,6 +255,11 @@ public:
    */
   virtual void check_starvation(void);
 
+  /**
+   * Mark the router active when a flit, credit or packet arrives
+   */
+  void wake(void);
+
 private:
   router_c();  // do not implement
 
@@ -246,7 +277,9 @@ protected:
   // configurations
   int m_link_latency; /**< link latency */
   int m_link_width; /**< link width */
-  int* m_total_packet; /**< number of total packets (global) */
+  int* m_total_packet; /**< number of total packets (network-wide) */
+  int* m_total_cpu_packet; /**< number of total cpu packets (network-wide) */
+  int* m_total_gpu_packet; /**< number of total gpu packets (network-wide) */
   bool m_enable_vc_partition; /**< enable virtual channel partition */
   int m_num_vc_cpu; /**< number of vcs for CPU */
   int m_next_vc; /**<id of next vc for local packet injection */
@@ -263,21 +296,21 @@ protected:
   unordered_map<int, int> m_opposite_dir; /**< opposite direction map */
 
   // buffers
-  list<mem_req_s*>* m_injection_buffer; /**< injection queue */
+  ring_queue_c<mem_req_s*>* m_injection_buffer; /**< injection queue */
   int m_injection_buffer_max_size; /**< max injection queue size */
-  queue<mem_req_s*>* m_req_buffer; /**< ejection queue */
+  ring_queue_c<mem_req_s*>* m_req_buffer; /**< ejection queue */
 
   int m_buffer_max_size; /**< input/output buffer max size */
 
   // per input port
-  list<flit_c*>** m_input_buffer; /**< input buffer */
+  ring_queue_c<flit_c*>** m_input_buffer; /**< input buffer */
   bool**** m_route; /**< route information */
   int** m_route_fixed; /**< determined rc for the packet */
   int** m_output_port_id; /**< output port id */
   int** m_output_vc_id; /**< output vc id */
 
   // per output port
-  list<flit_c*>** m_output_buffer; /**< output buffer */
+  ring_queue_c<flit_c*>** m_output_buffer; /**< output buffer */
   bool** m_output_vc_avail; /**< output vc availability */
   int** m_credit; /**< credit counter for the flow control */
   Counter* m_link_avail; /**< link availability */
@@ -286,10 +319,14 @@ protected:
   Counter* m_sw_avail; /**< switch availability */
 
   // credit-based flow control
-  list<credit_c*>* m_pending_credit; /**< pending credit to model latency */
+  ring_queue_c<credit_c*>* m_pending_credit; /**< pending credit to model latency */
 
   deque<router_c*> m_router_map; /**< link to other routers */
 
+  // active router bitmap
+  vector<uint64_t>* m_active_router; /**< active router bitmap (NULL: always ticked) */
+  int m_router_index; /**< bit of this router */
+
   // clock
   Counter m_cycle; /**< router clock */
 };
@@ -328,12 +365,34 @@ public:
 
   virtual void print() = 0;
 
+  // idle cycle skipping: cycles without any work / advance the clock
+  virtual Counter get_idle_cycles(void);
+  virtual void skip_cycles(Counter num_cycles);
+
+protected:
+  /**
+   * Register all routers in the active router bitmap
+   */
+  void init_active_routers(void);
+
+  /**
+   * Tick the routers with work
+   */
+  void run_active_routers(bool pll_lock);
+
+  /**
+   * First active router in [from, end) (end if none)
+   */
+  int next_active_router(int from, int end);
+
 protected:
   macsim_c* m_simBase;
   string m_topology; /**< topology */
 
   int m_num_router; /**< number of routers */
   int m_total_packet; /**< number of total packets */
+  int m_total_cpu_packet; /**< number of total cpu packets */
+  int m_total_gpu_packet; /**< number of total gpu packets */
   int m_num_cpu;
   int m_num_gpu;
   int m_num_l3;
@@ -345,6 +404,7 @@ protected:
 
   deque<router_c*> m_router; /**< all routers */
   unordered_map<int, int> m_router_map;
+  vector<uint64_t> m_active_router; /**< routers with flits, credits or packets to inject */
 
   Counter m_cycle; /**< clock cycle */
 };
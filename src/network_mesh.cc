@@ -47,10 +47,6 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #define DEBUG(args...) _DEBUG(*m_simBase->m_knobs->KNOB_DEBUG_NOC, ##args)
 
-extern int g_total_packet;
-extern int g_total_cpu_packet;
-extern int g_total_gpu_packet;
-
 /////////////////////////////////////////////////////////////////////////////////////////
 
 network_mesh_c::network_mesh_c(macsim_c* simBase) : network_c(simBase) {
@@ -61,11 +57,8 @@ network_mesh_c::~network_mesh_c() {
 
 // run one cycle for all routers
 void network_mesh_c::run_a_cycle(bool pll_lock) {
-  // randomized tick function
-  int index = CYCLE % m_num_router;
-  for (int ii = index; ii < index + m_num_router; ++ii) {
-    m_router[ii % m_num_router]->run_a_cycle(pll_lock);
-  }
+  // randomized tick function (routers without work are skipped)
+  run_active_routers(pll_lock);
   ++m_cycle;
 }
 
@@ -107,9 +100,10 @@ void network_mesh_c::init(int num_cpu, int num_gpu, int num_l3, int num_llc,
                          << " LLC:" << m_num_llc << " MC:" << m_num_mc);
 
   for (int ii = 0; ii < m_num_router; ++ii) {
-    m_router[ii]->init(m_num_router, &g_total_packet, m_flit_pool,
-                       m_credit_pool);
+    m_router[ii]->init(m_num_router, &m_total_packet, &m_total_cpu_packet,
+                       &m_total_gpu_packet, m_flit_pool, m_credit_pool);
   }
+  init_active_routers();
 
   // connect routers
   int* mapping = new int[m_num_router];
@@ -40,10 +40,6 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #define DEBUG(args...) _DEBUG(*m_simBase->m_knobs->KNOB_DEBUG_NOC, ##args)
 
-extern int g_total_packet;
-extern int g_total_cpu_packet;
-extern int g_total_gpu_packet;
-
 /////////////////////////////////////////////////////////////////////////////////////////
 
 network_simple_c::network_simple_c(macsim_c* simBase) : network_c(simBase) {
@@ -92,8 +88,8 @@ void network_simple_c::init(int num_cpu, int num_gpu, int num_l3, int num_llc,
                          << " LLC:" << m_num_llc << " MC:" << m_num_mc);
 
   for (int ii = 0; ii < m_num_router; ++ii) {
-    m_router[ii]->init(m_num_router, &g_total_packet, m_flit_pool,
-                       m_credit_pool);
+    m_router[ii]->init(m_num_router, &m_total_packet, &m_total_cpu_packet,
+                       &m_total_gpu_packet, m_flit_pool, m_credit_pool);
     m_router[ii]->set_router_map(m_router);
   }
 
@@ -127,25 +123,26 @@ void router_simple_c::run_a_cycle(bool pll_lock) {
 void router_simple_c::process(void) {
   int num_count = 0;
 
-  for (auto I = m_injection_buffer->begin(), E = m_injection_buffer->end();
-       I != E;) {
+  for (int ii = 0; ii < m_injection_buffer->size();) {
     if (num_count >= m_max_num_injection_from_src) break;
 
-    auto I_tmp = I++;
-    int dst_id = (*I_tmp)->m_msg_dst;
+    mem_req_s* req = m_injection_buffer->at(ii);
+    int dst_id = req->m_msg_dst;
     int* packet_inserted = m_router_map[dst_id]->get_num_packet_inserted();
     if (*packet_inserted < m_max_num_accept_in_dst) {
       // insert a packet to the destination
-      m_router_map[dst_id]->insert_packet((*I_tmp));
+      m_router_map[dst_id]->insert_packet(req);
 
       // increase injection count in dst
       ++(*packet_inserted);
 
       // remove from the current buffer
-      m_injection_buffer->erase(I_tmp);
+      m_injection_buffer->erase(ii);
 
       // increment current injection count from src
       ++num_count;
+    } else {
+      ++ii;
     }
   }
 }
@@ -154,6 +151,10 @@ int* router_simple_c::get_num_packet_inserted(void) {
   return &m_packet_inserted;
 }
 
+// simple routers do not keep their own clock
+void router_simple_c::skip_cycles(Counter num_cycles) {
+}
+
 // dummy functions
 // wrong oop design - should be removed
 void router_simple_c::stage_rc(void) {
@@ -53,6 +53,7 @@ public:
   virtual void stage_vca_pick_winner(int, int, int&, int&);
   virtual void reset(void);
   virtual int* get_num_packet_inserted(void);
+  virtual void skip_cycles(Counter num_cycles);
 
 private:
   router_simple_c();
@@ -0,0 +1,263 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : pool.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Slab-based object pool
+ *********************************************************************************************/
+
+#ifndef POOL_H_INCLUDED
+#define POOL_H_INCLUDED
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class macsim_c;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief pool class
+///
+/// Entries are constructed in contiguous slabs of pool_expand_unit entries and handed out
+/// from an intrusive free list (the link lives next to the entry in the same slot), so
+/// acquire/release never touch the heap. Released entries are not destructed; users
+/// re-initialize an entry after acquiring it. Free entries are destructed when the pool is
+/// deleted; entries that are still acquired may be referenced elsewhere, so they are left
+/// alone together with their slabs.
+///////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+class pool_c
+{
+private:
+  /**
+   * Pool slot. The entry is constructed in raw storage, which keeps the slot standard
+   * layout for any T, so release_entry() can find the slot with offsetof.
+   */
+  struct slot_s {
+    alignas(T) unsigned char m_storage[sizeof(T)]; /**< pool entry */
+    slot_s* m_next; /**< next free slot */
+  };
+  static_assert(std::is_standard_layout<slot_s>::value,
+                "pool slot must be standard layout");
+
+public:
+  /**
+   * Constructor
+   */
+  pool_c() {
+    init(1, "none");
+  }
+
+  /**
+   * Constructor
+   * @param pool_expand_unit number of entries when pool expands
+   * @param name pool name
+   */
+  pool_c(int pool_expand_unit, std::string name) {
+    init(pool_expand_unit, name);
+  }
+
+  /**
+   * Destructor
+   */
+  ~pool_c() {
+    for (slot_s* slot = m_free; slot; slot = slot->m_next) {
+      get_entry(slot)->~T();
+    }
+
+    if (m_num_in_use == 0) {
+      for (auto slab : m_slabs) {
+        ::operator delete(slab);
+      }
+    }
+  }
+
+  /**
+   * Acquire a new entry
+   */
+  T* acquire_entry(void) {
+    if (m_free == NULL) {
+      expand_pool();
+    }
+    return pop_free();
+  }
+
+  /**
+   * Acquire a new entry
+   *   whose class requires simBase reference
+   */
+  T* acquire_entry(macsim_c* m_simBase) {
+    if (m_free == NULL) {
+      expand_pool(m_simBase);
+    }
+    return pop_free();
+  }
+
+  /**
+   * Release a new entry
+   */
+  void release_entry(T* entry) {
+    slot_s* slot = get_slot(entry);
+    slot->m_next = m_free;
+    m_free = slot;
+    --m_num_in_use;
+  }
+
+  /**
+   * Expand the pool
+   */
+  void expand_pool(void) {
+    slot_s* slab = new_slab();
+    for (int ii = 0; ii < m_poolexpand_unit; ++ii) {
+      new (slab[ii].m_storage) T;
+    }
+    link_slab(slab);
+  }
+
+  /**
+   * Expand the pool
+   *  whose class requires simBase reference
+   */
+  void expand_pool(macsim_c* m_simBase) {
+    slot_s* slab = new_slab();
+    for (int ii = 0; ii < m_poolexpand_unit; ++ii) {
+      new (slab[ii].m_storage) T(m_simBase);
+    }
+    link_slab(slab);
+  }
+
+  /**
+   * Return the size of a pool
+   */
+  int size(void) {
+    return m_poolsize;
+  }
+
+  /**
+   * Return the number of entries currently acquired
+   */
+  int get_num_in_use(void) {
+    return m_num_in_use;
+  }
+
+  /**
+   * Return the maximum number of entries acquired at the same time (high-water mark)
+   */
+  int get_max_in_use(void) {
+    return m_max_in_use;
+  }
+
+  /**
+   * Return the pool name
+   */
+  const std::string& get_name(void) {
+    return m_name;
+  }
+
+private:
+  pool_c(const pool_c& rhs);  // do not implement
+  const pool_c& operator=(const pool_c& rhs);  // do not implement
+
+  /**
+   * Initialize an empty pool
+   */
+  void init(int pool_expand_unit, std::string name) {
+    m_free = NULL;
+    m_poolsize = 0;
+    m_poolexpand_unit = pool_expand_unit;
+    m_num_in_use = 0;
+    m_max_in_use = 0;
+    m_name = name;
+  }
+
+  /**
+   * Allocate raw storage for a new slab
+   */
+  slot_s* new_slab(void) {
+    slot_s* slab =
+      static_cast<slot_s*>(::operator new(sizeof(slot_s) * m_poolexpand_unit));
+    m_slabs.push_back(slab);
+    return slab;
+  }
+
+  /**
+   * Put the entries of a new slab on the free list, in address order.
+   * The pool only expands when the free list is empty.
+   */
+  void link_slab(slot_s* slab) {
+    for (int ii = 0; ii < m_poolexpand_unit - 1; ++ii) {
+      slab[ii].m_next = &slab[ii + 1];
+    }
+    slab[m_poolexpand_unit - 1].m_next = m_free;
+    m_free = slab;
+    m_poolsize += m_poolexpand_unit;
+  }
+
+  /**
+   * Take the first entry of the free list
+   */
+  T* pop_free(void) {
+    slot_s* slot = m_free;
+    m_free = slot->m_next;
+    if (++m_num_in_use > m_max_in_use) {
+      m_max_in_use = m_num_in_use;
+    }
+    return get_entry(slot);
+  }
+
+  /**
+   * Entry constructed in a slot
+   */
+  static T* get_entry(slot_s* slot) {
+    return reinterpret_cast<T*>(slot->m_storage);
+  }
+
+  /**
+   * Slot that holds an entry
+   */
+  static slot_s* get_slot(T* entry) {
+    return reinterpret_cast<slot_s*>(reinterpret_cast<unsigned char*>(entry) -
+                                     offsetof(slot_s, m_storage));
+  }
+
+  slot_s* m_free; /**< free list head */
+  std::vector<slot_s*> m_slabs; /**< allocated slabs */
+  int m_poolsize; /**< pool size */
+  int m_poolexpand_unit; /**< pool expand unit */
+  int m_num_in_use; /**< number of acquired entries */
+  int m_max_in_use; /**< high-water mark of acquired entries */
+  std::string m_name; /**< pool name */
+};
+
+#endif  // POOL_H_INCLUDED
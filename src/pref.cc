@@ -38,8 +38,6 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "all_knobs.h"
 
-static int prefetcher_id = 0;
-
 // hardware prefetcher base class constructor
 pref_base_c::pref_base_c(macsim_c* simBase)
   : init(true),
@@ -55,7 +53,7 @@ pref_base_c::pref_base_c(macsim_c* simBase)
   // hwp_info holds all hardware prefetcher related information
   hwp_info = new pref_info_s;
 
-  hwp_info->id = prefetcher_id++;
+  hwp_info->id = m_simBase->m_pref_id_gen++;
   hwp_info->useful = 0;
   hwp_info->sent = 0;
   hwp_info->late = 0;
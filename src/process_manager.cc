@@ -76,8 +76,12 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "statistics.h"
 #include "frontend.h"
 #include "process_manager.h"
+#include "trace_file.h"
+#include "checkpoint.h"
+#include "retire.h"
 #include "pref_common.h"
 #include "trace_read.h"
+#include "inst_info_cache.h"
 
 #include "debug_macros.h"
 
@@ -143,6 +147,7 @@ thread_s::thread_s(macsim_c *simBase) {
   int buf_ele_size =
     (CPU_TRACE_SIZE > GPU_TRACE_SIZE) ? CPU_TRACE_SIZE : GPU_TRACE_SIZE;
   m_buffer = new char[1000 * buf_ele_size];
+  m_trace_file = new trace_file_c(simBase);
   m_prev_trace_info = NULL;
   m_next_trace_info = NULL;
 
@@ -162,6 +167,7 @@ thread_s::~thread_s() {
 #if 0
   delete m_fetch_data;
   delete[] m_buffer;
+  delete m_trace_file;
   delete m_prev_trace_info;
   delete m_next_trace_info;
   
@@ -208,7 +214,8 @@ process_manager_c::process_manager_c(macsim_c *simBase) {
   // allocate queues
   m_thread_queue = new list<thread_trace_info_node_s *>;
   m_block_queue = new unordered_map<int, list<thread_trace_info_node_s *> *>;
-  m_inst_hash_pool = new pool_c<hash_c<inst_info_s> >(1, "inst_hash_pool");
+  m_inst_hash_pool = new pool_c<inst_info_cache_c>(1, "inst_hash_pool");
+  m_unique_thread_id = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -309,7 +316,7 @@ int process_manager_c::create_process(string appl, int repeat, int pid) {
   sstr << "inst_info_" << m_simBase->m_process_count;
   sstr >> name;
 
-  hash_c<inst_info_s> *new_inst_hash = m_inst_hash_pool->acquire_entry();
+  inst_info_cache_c *new_inst_hash = m_inst_hash_pool->acquire_entry(m_simBase);
   m_simBase->m_inst_info_hash[m_simBase->m_process_count] = new_inst_hash;
 
   // process data structure setup
@@ -414,6 +421,9 @@ int process_manager_c::create_process(string appl, int repeat, int pid) {
     process->m_core_pool = &m_simBase->m_x86_core_pool;
   }
 
+  // a restored application resumes at the kernel that was running at the checkpoint
+  m_simBase->m_checkpoint->restore_process(process);
+
   // now we set up a new process to execute it
   setup_process(process);
 
@@ -431,6 +441,8 @@ void process_manager_c::setup_process(process_s *process) {
 
   ASSERT(process->m_current_vector_index < process->m_applications.size());
 
+  m_simBase->m_checkpoint->kernel_started(process);
+
   // Each block within an application (across multiple kernels) has unique id
   process->m_kernel_block_start_count[process->m_current_vector_index] =
     process->m_block_count;
@@ -722,7 +734,7 @@ bool process_manager_c::terminate_process(process_s *process) {
   }
   process->m_core_list.clear();
 
-  hash_c<inst_info_s> *inst_info_hash =
+  inst_info_cache_c *inst_info_hash =
     m_simBase->m_inst_info_hash[process->m_process_id];
   m_simBase->m_inst_info_hash.erase(process->m_process_id);
   inst_info_hash->clear();
@@ -754,10 +766,6 @@ bool process_manager_c::terminate_process(process_s *process) {
   return true;
 }
 
-// try to give a unique thread id
-// counter to assign unique thread_ids to threads/warps
-static int global_unique_thread_id = 0;
-
 // create a new thread (actually, a thread has been created when create_thread_node()
 // has been called. However, when a thread is actually scheduled, we allocate and initialize
 // data in a thread.
@@ -805,7 +813,7 @@ thread_s *process_manager_c::create_thread(process_s *process, int tid,
   // trace_info->m_orig_thread_id = start_info->m_thread_id;
   // trace_info->m_unique_thread_id = global_unique_thread_id++;
   trace_info->m_unique_thread_id = (start_info->m_thread_id) % BLOCK_ID_MOD;
-  trace_info->m_orig_thread_id = global_unique_thread_id++;
+  trace_info->m_orig_thread_id = m_unique_thread_id++;
 
   // set up trace file name
   stringstream sstr;
@@ -817,9 +825,7 @@ thread_s *process_manager_c::create_thread(process_s *process, int tid,
 
 #ifndef USING_QSIM
   // open trace file
-  trace_info->m_trace_file = gzopen(filename.c_str(), "rb");
-  
-  if (trace_info->m_trace_file == NULL) {
+  if (!trace_info->m_trace_file->open(filename)) {
     int errnum = errno;
     const char* errmsg = strerror(errnum);
     printf("Error opening file %s: %s\n", filename.c_str(), errmsg);
@@ -856,6 +862,13 @@ thread_s *process_manager_c::create_thread(process_s *process, int tid,
   trace_info->m_prev_hmc_trans_id = 0;
   trace_info->m_next_hmc_trans_id = 0;
   trace_info->m_cur_hmc_trans_cnt = 0;
+
+  // a sampled thread starts with a fast-forward
+  trace_info->m_sample_window_end = 0;
+  trace_info->m_sample_measure_inst = 0;
+  trace_info->m_sample_start_cycle = 0;
+  trace_info->m_sample_measuring = false;
+  trace_info->m_sample_draining = true;
   return trace_info;
 }
 
@@ -866,6 +879,10 @@ int process_manager_c::terminate_thread(int core_id, thread_s *trace_info,
 
   ASSERT(core->m_running_thread_num);
 
+  // keep the trace position for later checkpoints
+  m_simBase->m_checkpoint->thread_terminated(
+    trace_info, core->get_retire()->get_instrs_retired(thread_id));
+
   // final heartbeat for the thread
   core->final_heartbeat(thread_id);
 
@@ -1024,7 +1041,7 @@ int process_manager_c::terminate_thread(int core_id, thread_s *trace_info,
     }
   }
 
-  gzclose(trace_info->m_trace_file);
+  trace_info->m_trace_file->close();
 
   // release thread_trace_info to the pool
   m_simBase->m_thread_pool->release_entry(trace_info);
@@ -1099,22 +1116,21 @@ thread_trace_info_node_s *process_manager_c::fetch_block(int block_id) {
   return front;
 }
 
-int process_manager_c::get_next_low_occupancy_core(std::string core_type) {
+int process_manager_c::get_next_low_occupancy_core(Core_Type core_type) {
   int least_occupied_core = -1;
   int min_occupancy = INT_MAX;
 
   for (int core_id = 0; core_id < *KNOB(KNOB_NUM_SIM_CORES); ++core_id) {
     core_c *core = m_simBase->m_core_pointers[core_id];
 
-    if (*KNOB(KNOB_ROUTER_PLACEMENT) == 1 && core->get_core_type() != "ptx" &&
-        core->get_core_type() != "nvbit" &&
+    if (*KNOB(KNOB_ROUTER_PLACEMENT) == 1 && !core->is_nvidia_core() &&
         (core_id < *KNOB(KNOB_CORE_ENABLE_BEGIN) ||
          *KNOB(KNOB_CORE_ENABLE_END) < core_id))
       continue;
 
     if ((core->m_running_thread_num < core->get_max_threads_per_core()) &&
         (core->m_running_thread_num < min_occupancy) &&
-        core->get_core_type() == core_type) {
+        core->get_core_type_id() == core_type) {
       least_occupied_core = core_id;
       min_occupancy = core->m_running_thread_num;
     }
@@ -1122,19 +1138,18 @@ int process_manager_c::get_next_low_occupancy_core(std::string core_type) {
   return least_occupied_core;
 }
 
-int process_manager_c::get_next_available_core(std::string core_type) {
+int process_manager_c::get_next_available_core(Core_Type core_type) {
   int result = -1;
   for (int core_id = 0; core_id < *KNOB(KNOB_NUM_SIM_CORES); ++core_id) {
     core_c *core = m_simBase->m_core_pointers[core_id];
 
-    if (*KNOB(KNOB_ROUTER_PLACEMENT) == 1 && core->get_core_type() != "ptx" &&
-        core->get_core_type() != "nvbit" &&
+    if (*KNOB(KNOB_ROUTER_PLACEMENT) == 1 && !core->is_nvidia_core() &&
         (core_id < *KNOB(KNOB_CORE_ENABLE_BEGIN) ||
          *KNOB(KNOB_CORE_ENABLE_END) < core_id))
       continue;
 
     if (core->m_running_thread_num < core->get_max_threads_per_core() &&
-        core->get_core_type() == core_type) {
+        core->get_core_type_id() == core_type) {
       result = core_id;
       break;
     }
@@ -1148,7 +1163,7 @@ int process_manager_c::get_next_available_core(std::string core_type) {
 // Order can be greedy or balanced
 void process_manager_c::sim_thread_schedule(bool initial) {
   std::string sched = KNOB(KNOB_CORE_THREAD_SCHED)->getValue();
-  int (process_manager_c::*get_next_core)(std::string core_type);
+  int (process_manager_c::*get_next_core)(Core_Type core_type);
 
   if (sched == "greedy")
     get_next_core = &process_manager_c::get_next_available_core;
@@ -1168,17 +1183,17 @@ void process_manager_c::sim_thread_schedule(bool initial) {
   // ptx continues to do whatever it was doing earlier
   // -pgera 03-20-2017
 
-  std::set<std::string> core_type_set;
+  bool core_type_set[NUM_CORE_TYPES] = {false};
   for (int core_id = 0; core_id < *KNOB(KNOB_NUM_SIM_CORES); ++core_id) {
     core_c *core = m_simBase->m_core_pointers[core_id];
-    core_type_set.insert(core->get_core_type());
+    core_type_set[core->get_core_type_id()] = true;
   }
 
   // Iterate over core types
-  for (std::set<std::string>::const_iterator itr = core_type_set.begin();
-       itr != core_type_set.end(); itr++) {
-    std::string core_type = *itr;
-    if (core_type == "ptx" || core_type == "nvbit") continue;
+  for (int type = 0; type < NUM_CORE_TYPES; ++type) {
+    if (!core_type_set[type]) continue;
+    Core_Type core_type = static_cast<Core_Type>(type);
+    if (core_type == CORE_PTX || core_type == CORE_NVBIT) continue;
 
     // Get a core of this type
     // Follow the knob policy (greedy or balanced)
@@ -1240,8 +1255,7 @@ void process_manager_c::sim_thread_schedule(bool initial) {
     thread_trace_info_node_s *trace_to_run;
     core_c *core = m_simBase->m_core_pointers[core_id];
 
-    std::string core_type = core->get_core_type();
-    if (core_type != "ptx" && core_type != "nvbit") continue;
+    if (!core->is_nvidia_core()) continue;
 
     // get currently fetching id
     int prev_fetching_block_id = core->m_fetching_block_id;
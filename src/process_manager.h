@@ -181,7 +181,7 @@ typedef struct thread_s {
   int m_orig_block_id; /**< original block id from a trace*/
   int m_orig_thread_id; /**< adjusted block id */
   int m_block_id; /**< block id */
-  gzFile m_trace_file; /**< gzip trace file */
+  trace_file_c* m_trace_file; /**< trace file stream */
   bool m_file_opened; /**< trace file opened? */
   bool m_main_thread; /**< main thread (usually thread id 0) */
   uint64_t m_inst_count; /**< total instruction counts */
@@ -226,6 +226,13 @@ typedef struct thread_s {
   uint64_t m_next_hmc_trans_id;
   uint64_t m_cur_hmc_trans_cnt;  // the #th mem uop in the trans
   uns16 m_last_dest_reg;
+
+  // sampled simulation
+  Counter m_sample_window_end; /**< delivered instructions that end the detailed window */
+  Counter m_sample_measure_inst; /**< delivered instructions that start the measurement */
+  Counter m_sample_start_cycle; /**< core cycle the measurement started */
+  bool m_sample_measuring; /**< measured part of the window has started */
+  bool m_sample_draining; /**< fetch stopped until the window retires */
 } thread_s;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -348,13 +355,13 @@ public:
    * Break ties lexicographically
    * Return -1 if no core available
    */
-  int get_next_low_occupancy_core(std::string core_type);
+  int get_next_low_occupancy_core(Core_Type core_type);
 
   /**
    * Return the first available core where we can run a thread
    * Return -1 if no core available
    */
-  int get_next_available_core(std::string core_type);
+  int get_next_available_core(Core_Type core_type);
 
   /**
    * Schedule a new thread
@@ -406,7 +413,8 @@ private:
   list<thread_trace_info_node_s*>* m_thread_queue; /**< thread queue */
   unordered_map<int, list<thread_trace_info_node_s*>*>*
     m_block_queue; /**< block queue */
-  pool_c<hash_c<inst_info_s> >* m_inst_hash_pool; /**< instruction hash pool */
+  pool_c<inst_info_cache_c>* m_inst_hash_pool; /**< decoded instruction cache pool */
+  int m_unique_thread_id; /**< counter to assign unique ids to threads/warps */
 
   unordered_map<int, Counter>
     m_appl_cyccount_info; /**< per application cycle count info */
@@ -102,6 +102,7 @@ POSSIBILITY OF SUCH DAMAGE.
 retire_c::retire_c(RETIRE_INTERFACE_PARAMS(), macsim_c* simBase)
   : RETIRE_INTERFACE_INIT() {
   m_simBase = simBase;
+  m_knob_values = simBase->m_knob_values;
 
   m_retire_running = false;
   m_total_insts_retired = 0;
@@ -168,10 +169,10 @@ void retire_c::run_a_cycle() {
       cur_uop = rob->front();
 
       // uncompleted memory store UOPs can be placed in write buffer
-      if (KNOB(KNOB_USE_WB)->getValue() && cur_uop->m_mem_type == MEM_ST &&
+      if (KNOB_VALUE(KNOB_USE_WB) && cur_uop->m_mem_type == MEM_ST &&
           cur_uop->m_exec_cycle != 0) {
         // write buffer full
-        if (m_write_buffer.size() == KNOB(KNOB_WB_SIZE)->getValue()) {
+        if (m_write_buffer.size() == KNOB_VALUE(KNOB_WB_SIZE)) {
           STAT_CORE_EVENT(cur_uop->m_core_id, WB_FULL);
           break;
         }
@@ -208,7 +209,7 @@ void retire_c::run_a_cycle() {
         }
       }
 
-      if (KNOB(KNOB_FENCE_ENABLE)->getValue() &&
+      if (KNOB_VALUE(KNOB_FENCE_ENABLE) &&
           (cur_uop->m_uop_type == UOP_FULL_FENCE ||
            cur_uop->m_uop_type == UOP_ACQ_FENCE ||
            cur_uop->m_uop_type == UOP_REL_FENCE)) {
@@ -222,7 +223,7 @@ void retire_c::run_a_cycle() {
           "thread_id:%d uop_num:%llu inst_num:%llu fence operations \n",
           cur_uop->m_thread_id, cur_uop->m_uop_num, cur_uop->m_inst_num);
 
-        if (KNOB(KNOB_ACQ_REL)->getValue()) {
+        if (KNOB_VALUE(KNOB_ACQ_REL)) {
           fence_type ft;
           switch (cur_uop->m_uop_type) {
             case UOP_ACQ_FENCE:
@@ -291,7 +292,7 @@ void retire_c::run_a_cycle() {
     process_s* process = thread_trace_info->m_process;
     if (cur_uop->m_last_uop ||
         m_insts_retired[cur_uop->m_thread_id] >=
-          *m_simBase->m_knobs->KNOB_MAX_INSTS) {
+          KNOB_VALUE(KNOB_MAX_INSTS)) {
       core->m_thread_reach_end[cur_uop->m_thread_id] = true;
       if (!core->m_thread_finished[cur_uop->m_thread_id]) {
         ++core->m_num_thread_reach_end;
@@ -315,7 +316,7 @@ void retire_c::run_a_cycle() {
           if (process->m_current_vector_index ==
                 process->m_applications.size() ||
               (*m_simBase->m_ProcessorStats)[INST_COUNT_TOT].getCount() >=
-                *KNOB(KNOB_MAX_INSTS1)) {
+                KNOB_VALUE(KNOB_MAX_INSTS1)) {
             update_stats(process);
             m_simBase->m_process_manager->terminate_process(process);
             if (m_simBase->m_process_count_without_repeat == 0) {
@@ -359,7 +360,7 @@ void retire_c::run_a_cycle() {
       m_resource->dealloc_fp_reg();
     }
 
-    if (KNOB(KNOB_USE_WB)->getValue()) {
+    if (KNOB_VALUE(KNOB_USE_WB)) {
       // free uop resources only for uops not in write buffer
       if (cur_uop->m_mem_type != MEM_ST) free_uop_resources(cur_uop);
     } else {
@@ -419,7 +420,7 @@ void retire_c::drain_wb(void) {
         cur_uop->m_exec_cycle == 0) {
       // this store cannot be completed yet
       // if FIFO completion, we cannot complete any later stores
-      if (KNOB(KNOB_WB_FIFO)->getValue()) break;
+      if (KNOB_VALUE(KNOB_WB_FIFO)) break;
 
       ++uop_it;
     } else {
@@ -427,7 +428,7 @@ void retire_c::drain_wb(void) {
 
       // if version of the uop is greater than root fence version
       // then you cannot retire this uop yet
-      if (KNOB(KNOB_ACQ_REL)->getValue()) {
+      if (KNOB_VALUE(KNOB_ACQ_REL)) {
         // if current uop is store release and is oldest in wb, drain it
         if (cur_uop->m_bar_type == REL_BAR) {
           if (uop_it != m_write_buffer.begin()) {
@@ -440,7 +441,7 @@ void retire_c::drain_wb(void) {
           ++uop_it;
 
           // if FIFO completioin, we cannot complete any more stores
-          if (KNOB(KNOB_WB_FIFO)->getValue()) break;
+          if (KNOB_VALUE(KNOB_WB_FIFO)) break;
 
           continue;
         }
@@ -486,12 +487,12 @@ write_buffer_c::iterator retire_c::delete_wb(write_buffer_c::iterator it) {
 // free uop
 void retire_c::free_uop_resources(uop_c* cur_uop) {
   for (int ii = 0; ii < cur_uop->m_num_child_uops; ++ii) {
-    if (*m_simBase->m_knobs->KNOB_BUG_DETECTOR_ENABLE)
+    if (KNOB_VALUE(KNOB_BUG_DETECTOR_ENABLE))
       m_simBase->m_bug_detector->deallocate(cur_uop->m_child_uops[ii]);
     m_uop_pool->release_entry(cur_uop->m_child_uops[ii]->free());
   }
 
-  if (*m_simBase->m_knobs->KNOB_BUG_DETECTOR_ENABLE)
+  if (KNOB_VALUE(KNOB_BUG_DETECTOR_ENABLE))
     m_simBase->m_bug_detector->deallocate(cur_uop);
 
   delete[] cur_uop->m_child_uops;
@@ -516,6 +517,24 @@ bool retire_c::is_running() {
   return m_retire_running;
 }
 
+// the head of rob waits for execution or memory
+Counter retire_c::get_idle_cycles() {
+  if (m_ptx_sim || m_igpu_sim || m_nvbit_sim) return 0;
+
+  if (!m_write_buffer.empty()) return 0;
+
+  if (m_rob->entries() == 0) return ULLONG_MAX;
+
+  uop_c* cur_uop = m_rob->front();
+  if (KNOB_VALUE(KNOB_USE_WB) && cur_uop->m_mem_type == MEM_ST &&
+      cur_uop->m_exec_cycle != 0)
+    return 0;
+
+  if (!cur_uop->m_done_cycle || !cur_uop->m_exec_cycle) return ULLONG_MAX;
+
+  return 0;
+}
+
 #if 0
 // return number of retired instructions per thread
 inline Counter retire_c::get_instrs_retired(int thread_id)
@@ -542,7 +561,7 @@ void retire_c::update_stats(process_s* process) {
   // TOCHECK I will get back to this later
   if (*KNOB(KNOB_REPEAT_TRACE) &&
       process->m_repeat < *KNOB(KNOB_REPEAT_TRACE_N) &&
-      (core->get_core_type() == "ptx" || core->get_core_type() == "nvbit")) {
+      core->is_nvidia_core()) {
     if ((process->m_repeat + 1) == *m_simBase->m_knobs->KNOB_REPEAT_TRACE_N) {
       --m_simBase->m_process_count_without_repeat;
       STAT_EVENT_N(CYC_COUNT_ACC, CYCLE);
@@ -554,7 +573,7 @@ void retire_c::update_stats(process_s* process) {
     }
   } else {
     if (process->m_repeat == 0) {
-      if ((core->get_core_type() == "ptx") || (core->get_core_type() == "nvbit")) {
+      if (core->is_nvidia_core()) {
         STAT_EVENT_N(CYC_COUNT_ACC, CYCLE);
       } else {
         STAT_EVENT_N(CYC_COUNT_X86, CYCLE);
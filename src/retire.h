@@ -110,6 +110,11 @@ public:
    */
   void run_a_cycle();
 
+  /**
+   * Check whether the head of rob waits for execution (0: busy, ULLONG_MAX: idle)
+   */
+  Counter get_idle_cycles();
+
   /**
    * Enable retirement stage
    */
@@ -132,6 +137,13 @@ public:
     return m_insts_retired[thread_id];
   }
 
+  /**
+   * Set number of retired instruction with thread_id (thread restored from a checkpoint)
+   */
+  inline void set_instrs_retired(int thread_id, Counter num_insts) {
+    m_insts_retired[thread_id] = num_insts;
+  }
+
   /**
    * Get number of retired uops with thread_id
    */
@@ -234,6 +246,7 @@ private:
     m_period_inst_count; /**< counter for periodic logging number of retired inst. */
 
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  const all_knob_values_s* m_knob_values; /**< knob snapshot for hot paths */
 };
 
 #endif  // RETIRE_H_INCLUDED
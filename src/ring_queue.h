@@ -0,0 +1,168 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : ring_queue.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Ring-buffer FIFO for NoC buffers
+ *********************************************************************************************/
+
+#ifndef RING_QUEUE_H_INCLUDED
+#define RING_QUEUE_H_INCLUDED
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Ring-buffer FIFO
+///
+/// Entries live in one power-of-two array sized by reserve() to the modeled buffer depth,
+/// so pushes and pops do not touch the heap. A queue that outgrows its array (buffers
+/// whose occupancy is not bounded by flow control) doubles it; get_num_expand() counts
+/// these allocations.
+///////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+class ring_queue_c
+{
+public:
+  /**
+   * Constructor (no storage until reserve() or the first push)
+   */
+  ring_queue_c() {
+    m_entry = NULL;
+    m_mask = -1;
+    m_head = 0;
+    m_count = 0;
+    m_num_expand = 0;
+  }
+
+  /**
+   * Destructor
+   */
+  ~ring_queue_c() {
+    delete[] m_entry;
+  }
+
+  /**
+   * Allocate room for at least capacity entries (not counted as an expansion)
+   */
+  void reserve(int capacity) {
+    if (capacity > m_mask + 1) resize(capacity);
+  }
+
+  /**
+   * Check whether the queue is empty
+   */
+  bool empty(void) const {
+    return m_count == 0;
+  }
+
+  /**
+   * Number of entries
+   */
+  int size(void) const {
+    return m_count;
+  }
+
+  /**
+   * Oldest entry
+   */
+  T& front(void) {
+    return m_entry[m_head];
+  }
+
+  /**
+   * N-th oldest entry
+   */
+  T& at(int pos) {
+    return m_entry[(m_head + pos) & m_mask];
+  }
+
+  /**
+   * Append an entry
+   */
+  void push_back(const T& entry) {
+    if (m_count == m_mask + 1) {
+      resize(m_count + 1);
+      ++m_num_expand;
+    }
+    m_entry[(m_head + m_count) & m_mask] = entry;
+    ++m_count;
+  }
+
+  /**
+   * Remove the oldest entry
+   */
+  void pop_front(void) {
+    m_head = (m_head + 1) & m_mask;
+    --m_count;
+  }
+
+  /**
+   * Remove the N-th oldest entry (younger entries move up)
+   */
+  void erase(int pos) {
+    for (int ii = pos; ii < m_count - 1; ++ii) at(ii) = at(ii + 1);
+    --m_count;
+  }
+
+  /**
+   * Number of times the array had to grow beyond the reserved size
+   */
+  int get_num_expand(void) const {
+    return m_num_expand;
+  }
+
+private:
+  ring_queue_c(const ring_queue_c& rhs);  // do not implement
+  const ring_queue_c& operator=(const ring_queue_c& rhs);  // do not implement
+
+  /**
+   * Move the entries to a power-of-two array of at least capacity entries
+   */
+  void resize(int capacity) {
+    int size = 1;
+    while (size < capacity) size <<= 1;
+
+    T* entry = new T[size];
+    for (int ii = 0; ii < m_count; ++ii) entry[ii] = at(ii);
+    delete[] m_entry;
+
+    m_entry = entry;
+    m_mask = size - 1;
+    m_head = 0;
+  }
+
+  T* m_entry; /**< entry array */
+  int m_mask; /**< array size - 1 */
+  int m_head; /**< index of the oldest entry */
+  int m_count; /**< number of entries */
+  int m_num_expand; /**< number of growths beyond the reserved size */
+};
+
+#endif  // RING_QUEUE_H_INCLUDED
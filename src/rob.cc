@@ -50,6 +50,7 @@ POSSIBILITY OF SUCH DAMAGE.
 // rob_c constructor
 rob_c::rob_c(Unit_Type type, macsim_c *simBase) : m_fence(simBase) {
   m_simBase = simBase;
+  m_knob_values = simBase->m_knob_values;
 
   m_unit_type = type;
 
@@ -107,7 +108,7 @@ void rob_c::process_version(uop_c *uop) {
 
   // save full fences and load acquire fences in orq
   if (uop->m_uop_type == UOP_FULL_FENCE || uop->m_uop_type == UOP_ACQ_FENCE) {
-    if (KNOB(KNOB_FENCE_ENABLE)->getValue()) {
+    if (KNOB_VALUE(KNOB_FENCE_ENABLE)) {
       orq_entry oentry = {uop->m_uop_num, m_last_fence_version};
       // we remove this uop when the lowest version in write buffer is greater
       // than this version
@@ -223,7 +224,7 @@ bool rob_c::pending_mem_ops(int entry) {
     search_idx = (search_idx + 1) % m_max_cnt;
   }
 
-  if (KNOB(KNOB_USE_WB)->getValue()) return m_wb_empty == false;
+  if (KNOB_VALUE(KNOB_USE_WB)) return m_wb_empty == false;
 
   return false;
 }
@@ -247,7 +248,7 @@ bool rob_c::is_later_entry(int first_fence_entry, int entry) {
 // true: ensure ordering, false: no ordering necessary
 bool rob_c::ensure_mem_ordering(int entry) {
   // ordering is ensured using versions
-  if (KNOB(KNOB_ACQ_REL)->getValue()) return false;
+  if (KNOB_VALUE(KNOB_ACQ_REL)) return false;
 
   // no fence active, no ordering necessary
   if (m_fence.is_list_empty()) return false;
@@ -256,6 +256,7 @@ private:
   unordered_map<Counter, bool> m_root_fences; /*< parent uop of fence inst */
 
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  const all_knob_values_s* m_knob_values; /**< knob snapshot for hot paths */
 };
 
 #endif  // ROB_H_INCLUDED
@@ -87,6 +87,8 @@ smc_rob_c::smc_rob_c(Unit_Type type, int core_id, macsim_c* simBase) {
     m_free_list.push_back(i);
   }
 
+  m_active_robs.reserve(m_knob_num_threads);
+
   m_core_id = core_id;
 }
 
@@ -119,6 +121,7 @@ rob_c* smc_rob_c::get_thread_rob(int thread_id) {
     while (itr != end) {
       if (itr->first != count) {
         m_thread_to_rob_map[thread_id] = count;
+        update_active_robs();
         return m_thread_robs[count];
       }
       ++itr;
@@ -126,6 +129,7 @@ rob_c* smc_rob_c::get_thread_rob(int thread_id) {
     }
 
     m_thread_to_rob_map[thread_id] = count;
+    update_active_robs();
 
     return m_thread_robs[count];
   }
@@ -154,6 +158,7 @@ int smc_rob_c::reserve_rob(int thread_id) {
 
   m_thread_to_rob_map.insert(std::pair<int, int>(thread_id, index));
   m_thread_robs[index]->reinit();
+  update_active_robs();
 
   return index;
 }
@@ -166,6 +171,18 @@ void smc_rob_c::free_rob(int thread_id) {
 
   m_free_list.push_back(m_thread_to_rob_map[thread_id]);
   m_thread_to_rob_map.erase(thread_id);
+  update_active_robs();
+}
+
+// copy reserved robs in thread to rob map order
+//   the map only changes when a rob is reserved or freed, so the retire scan
+//   can read a dense array and still visit threads in the same order
+void smc_rob_c::update_active_robs(void) {
+  m_active_robs.clear();
+  for (auto I = m_thread_to_rob_map.begin(), E = m_thread_to_rob_map.end();
+       I != E; ++I) {
+    m_active_robs.push_back(I->second);
+  }
 }
 
 // uop sort function used in get_n_uops_in_ready_order
@@ -185,12 +202,12 @@ bool sort_uops(uop_c* a, uop_c* b) {
 
 // get a list of retireable uops from multiple threads
 // called by retire stage
+//   reserved robs are kept in a dense array so that the scan does not chase
+//   hash map nodes
 vector<uop_c*>* smc_rob_c::get_n_uops_in_ready_order(int n,
                                                      Counter core_cycle) {
-  for (auto I = m_thread_to_rob_map.begin(), E = m_thread_to_rob_map.end();
-       I != E; ++I) {
-    int index = I->second;
-    rob_c* rob = m_thread_robs[index];
+  for (int ii = 0, size = m_active_robs.size(); ii < size; ++ii) {
+    rob_c* rob = m_thread_robs[m_active_robs[ii]];
 
     if (rob->entries()) {
       uop_c* uop = rob->front();
@@ -104,9 +104,16 @@ public:
   vector<uop_c*>* get_n_uops_in_ready_order(int n, Counter cur_core_cycle);
 
 private:
+  /**
+   *  \brief Function to refresh m_active_robs after m_thread_to_rob_map changes
+   *  \return void.
+   */
+  void update_active_robs(void);
+
   int m_knob_num_threads; /**< max threads per core */
   rob_c** m_thread_robs; /**< reorder buffer per thread */
   list<int> m_free_list; /**< thread rob pool */
+  vector<int> m_active_robs; /**< reserved robs in map order, scanned by retire */
   vector<uop_c*> m_uop_list; /**< retireable uop list */
   int m_core_id; /**< core id */
   Unit_Type m_unit_type; /**< core type */
@@ -0,0 +1,188 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : sampler.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Sampled simulation with functional fast-forward
+ *********************************************************************************************/
+
+#include <cmath>
+
+#include "sampler.h"
+#include "assert_macros.h"
+#include "core.h"
+#include "debug_macros.h"
+#include "frontend.h"
+#include "macsim.h"
+#include "process_manager.h"
+#include "retire.h"
+#include "trace_read.h"
+#include "trace_read_cpu.h"
+
+#include "all_knobs.h"
+#include "statistics.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// sampler_c constructor
+sampler_c::sampler_c(macsim_c* simBase) {
+  m_simBase = simBase;
+  m_ff_insts = *KNOB(KNOB_SAMPLE_FF_INSTS);
+  m_warmup_insts = *KNOB(KNOB_SAMPLE_WARMUP_INSTS);
+  m_detail_insts = *KNOB(KNOB_SAMPLE_DETAIL_INSTS);
+  m_enable = m_ff_insts > 0 && m_detail_insts > 0;
+
+  if (m_enable) {
+    ASSERTM(KNOB(KNOB_LARGE_CORE_TYPE)->getValue() == "x86",
+            "sampled simulation supports x86 traces only\n");
+    // these features keep per-instruction state that the fast-forward does not update
+    ASSERTM(!*KNOB(KNOB_ENABLE_HMC_INST) && !*KNOB(KNOB_ENABLE_HMC_TRANS) &&
+              !*KNOB(KNOB_ENABLE_HMC_INST_SKIP),
+            "sampled simulation does not support hmc instructions\n");
+    ASSERTM(!*KNOB(KNOB_ENABLE_PHYSICAL_MAPPING),
+            "sampled simulation does not support physical page mapping\n");
+    ASSERTM(*KNOB(KNOB_CHECKPOINT_SAVE_CYCLE) == 0 &&
+              KNOB(KNOB_CHECKPOINT_RESTORE_FILE)->getValue() == "none",
+            "sampled simulation does not support checkpoints\n");
+
+    core_sample_s empty = {0, 0.0, 0.0, 0};
+    m_core.assign(*KNOB(KNOB_NUM_SIM_CORES), empty);
+  }
+}
+
+// sampler_c destructor
+sampler_c::~sampler_c() {
+}
+
+bool sampler_c::fetch_ready(int core_id, int sim_thread_id) {
+  core_c* core = m_simBase->m_core_pointers[core_id];
+  thread_s* thread = core->get_trace_info(sim_thread_id);
+  if (!thread->m_sample_draining) return true;
+
+  // the window has retired when every uop fetched by the thread has retired
+  retire_c* retire = core->get_retire();
+  if (retire->get_uops_retired(sim_thread_id) < thread->m_temp_uop_count)
+    return false;
+
+  core_sample_s& sample = m_core[core_id];
+  if (thread->m_sample_measuring) {
+    Counter num_insts =
+      thread->m_sample_window_end - thread->m_sample_measure_inst;
+    Counter num_cycles = core->get_cycle_count() - thread->m_sample_start_cycle;
+    double cpi = static_cast<double>(num_cycles) / num_insts;
+
+    ++sample.m_num_windows;
+    sample.m_cpi_sum += cpi;
+    sample.m_cpi_sq_sum += cpi * cpi;
+
+    STAT_EVENT(SAMPLE_WINDOWS);
+    STAT_EVENT_N(SAMPLE_DETAIL_INSTS, num_insts);
+    STAT_EVENT_N(SAMPLE_DETAIL_CYCLES, num_cycles);
+  }
+
+  // skipped instructions count as retired, so KNOB_MAX_INSTS covers the same part of the
+  // trace as a detailed run
+  Counter skipped =
+    m_simBase->m_trace_reader->fast_forward(core_id, sim_thread_id, m_ff_insts);
+  retire->set_instrs_retired(
+    sim_thread_id, retire->get_instrs_retired(sim_thread_id) + skipped);
+  sample.m_ff_insts += skipped;
+  STAT_EVENT_N(SAMPLE_FF_INSTS, skipped);
+
+  // fetch resumes at the first instruction after the skipped ones
+  trace_info_cpu_s* prev_trace_info =
+    static_cast<trace_info_cpu_s*>(thread->m_prev_trace_info);
+  thread->m_fetch_data->m_MT_scheduler.m_next_fetch_addr =
+    prev_trace_info->m_instruction_addr;
+
+  // next window
+  thread->m_sample_measure_inst = thread->m_temp_inst_count + m_warmup_insts;
+  thread->m_sample_window_end = thread->m_sample_measure_inst + m_detail_insts;
+  thread->m_sample_measuring = false;
+  thread->m_sample_draining = false;
+
+  return true;
+}
+
+bool sampler_c::window_end(int core_id, int sim_thread_id) {
+  core_c* core = m_simBase->m_core_pointers[core_id];
+  thread_s* thread = core->get_trace_info(sim_thread_id);
+
+  // windows are cut at instruction boundaries
+  if (!thread->m_bom) return false;
+
+  if (!thread->m_sample_measuring &&
+      thread->m_temp_inst_count >= thread->m_sample_measure_inst) {
+    thread->m_sample_measuring = true;
+    thread->m_sample_start_cycle = core->get_cycle_count();
+  }
+
+  if (thread->m_temp_inst_count < thread->m_sample_window_end) return false;
+
+  thread->m_sample_draining = true;
+  return true;
+}
+
+// windows cut short by the end of a thread are not measured
+void sampler_c::finalize(void) {
+  if (!m_enable) return;
+
+  Counter est_cycles = 0;
+  Counter est_ci95 = 0;
+  for (int ii = 0; ii < static_cast<int>(m_core.size()); ++ii) {
+    core_sample_s& sample = m_core[ii];
+    if (sample.m_num_windows == 0) continue;
+
+    double n = static_cast<double>(sample.m_num_windows);
+    double mean = sample.m_cpi_sum / n;
+    double var = 0.0;
+    if (sample.m_num_windows > 1)
+      var = MAX2((sample.m_cpi_sq_sum - n * mean * mean) / (n - 1), 0.0);
+    double ci95 = 1.96 * sqrt(var / n);
+
+    Counter num_insts =
+      m_simBase->m_core_pointers[ii]->get_retire()->get_total_insts_retired() +
+      sample.m_ff_insts;
+    Counter cycles = static_cast<Counter>(mean * num_insts + 0.5);
+
+    REPORT("core %d sampling: %llu windows, CPI %.4f +- %.4f (95%%), "
+           "estimated cycles %llu\n",
+           ii, sample.m_num_windows, mean, ci95, cycles);
+
+    if (cycles > est_cycles) {
+      est_cycles = cycles;
+      est_ci95 = static_cast<Counter>(ci95 * num_insts + 0.5);
+    }
+  }
+
+  STAT_EVENT_N(SAMPLE_EST_CYC_COUNT, est_cycles);
+  STAT_EVENT_N(SAMPLE_EST_CYC_CI95, est_ci95);
+}
@@ -0,0 +1,117 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : sampler.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Sampled simulation with functional fast-forward
+ *********************************************************************************************/
+
+#ifndef SAMPLER_H_INCLUDED
+#define SAMPLER_H_INCLUDED
+
+#include <vector>
+
+#include "global_defs.h"
+#include "global_types.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Systematic sampling of x86 threads
+///
+/// Every thread repeats the same period: sample_ff_insts instructions are skipped
+/// functionally (they only warm the caches and branch predictors), then sample_warmup_insts
+/// + sample_detail_insts instructions run through the pipeline. Fetch stops at the end of
+/// the window and the fast-forward starts once the window has retired, so the measured
+/// cycles of a window run from the fetch of its first measured instruction to the
+/// retirement of its last one.
+///
+/// At the end of the simulation, the mean window CPI of each core is applied to all
+/// instructions of that core (skipped + detailed) and the longest core gives the estimated
+/// cycle count. The confidence interval assumes independent windows. With more than one
+/// thread per core, windows of different threads overlap and the estimate is less accurate.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class sampler_c
+{
+public:
+  /**
+   * Constructor
+   */
+  sampler_c(macsim_c* simBase);
+
+  /**
+   * Destructor
+   */
+  ~sampler_c();
+
+  /**
+   * Check whether a thread can fetch. When its detailed window has retired, the thread is
+   * fast-forwarded and the next window starts
+   * @param core_id - core id
+   * @param sim_thread_id - thread id
+   * @return false while the window drains
+   */
+  bool fetch_ready(int core_id, int sim_thread_id);
+
+  /**
+   * Called before each fetched uop : check whether the detailed window of a thread ends
+   * at the current instruction boundary
+   * @param core_id - core id
+   * @param sim_thread_id - thread id
+   * @return true if fetch has to stop
+   */
+  bool window_end(int core_id, int sim_thread_id);
+
+  /**
+   * Compute the extrapolated cycle count and its confidence interval
+   */
+  void finalize(void);
+
+private:
+  sampler_c();  // do not implement
+
+  /**
+   * Window statistics of a core
+   */
+  typedef struct core_sample_s {
+    Counter m_num_windows; /**< number of measured windows */
+    double m_cpi_sum; /**< sum of window CPIs */
+    double m_cpi_sq_sum; /**< sum of squared window CPIs */
+    Counter m_ff_insts; /**< fast-forwarded instructions */
+  } core_sample_s;
+
+  macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  bool m_enable; /**< sampled simulation */
+  Counter m_ff_insts; /**< instructions skipped per period */
+  Counter m_warmup_insts; /**< unmeasured detailed instructions per window */
+  Counter m_detail_insts; /**< measured instructions per window */
+  std::vector<core_sample_s> m_core; /**< per-core window statistics */
+};
+
+#endif  // SAMPLER_H_INCLUDED
@@ -59,6 +59,7 @@ schedule_c::schedule_c(exec_c* exec, int core_id, Unit_Type unit_type,
                        frontend_c* frontend, pqueue_c<int>** alloc_q,
                        macsim_c* simBase) {
   m_simBase = simBase;
+  m_knob_values = simBase->m_knob_values;
   m_alloc_q = alloc_q;
   m_exec = exec;
   m_core_id = core_id;
@@ -104,6 +105,11 @@ bool schedule_c::is_running() {
   return m_schedule_running;
 }
 
+// schedulers that do not model idle cycles are always busy
+Counter schedule_c::get_idle_cycles(void) {
+  return 0;
+}
+
 // check source registers are ready
 bool schedule_c::check_srcs(int entry) {
   bool ready = true;
@@ -187,7 +193,7 @@ bool schedule_c::uop_schedule(int entry, SCHED_FAIL_TYPE* sched_fail_reason) {
              cur_uop->m_done_cycle);
 
   core_c* core = m_simBase->m_core_pointers[m_core_id];
-  if (core->get_core_type() == "igpu") {
+  if (core->get_core_type_id() == CORE_IGPU) {
     // Schedule SIMD instruction every other cycle for Intel GPU
     DEBUG_CORE(m_core_id,
                "m_core_id:%d m_last_sched_cycle:%llu m_cur_core_cycle:%llu\n",
@@ -227,13 +233,13 @@ bool schedule_c::uop_schedule(int entry, SCHED_FAIL_TYPE* sched_fail_reason) {
     }
 
     // Check if fence is active
-    if (*KNOB(KNOB_FENCE_ENABLE) && cur_uop->m_mem_type != NOT_MEM &&
+    if (KNOB_VALUE(KNOB_FENCE_ENABLE) && cur_uop->m_mem_type != NOT_MEM &&
         m_rob->ensure_mem_ordering(entry)) {
       *sched_fail_reason = SCHED_FAIL_FENCE_ACTIVE;
       STAT_CORE_EVENT(m_core_id, FENCE_WAITING);
       STAT_CORE_EVENT(m_core_id, WB_ORDERING_STALL);
 
-      if (*KNOB(KNOB_FENCE_PREF_ENABLE)) m_exec->insert_fence_pref(cur_uop);
+      if (KNOB_VALUE(KNOB_FENCE_PREF_ENABLE)) m_exec->insert_fence_pref(cur_uop);
 
       // prefetch execution hack
       DEBUG_CORE(m_core_id,
@@ -134,6 +134,12 @@ public:
    */
   virtual bool is_running(void);
 
+  /*! \fn Counter get_idle_cycles()
+   *  \brief Function to get the number of upcoming cycles without scheduling.
+   *  \return Counter - 0 if busy (default), ULLONG_MAX if waiting for others
+   */
+  virtual Counter get_idle_cycles(void);
+
 protected:
   /**
    *  \brief Function to check if the source of an uop are yet tp be scheduled
@@ -181,6 +187,7 @@ protected:
   uns16 m_knob_sched_to_width; /**< knob sched to width FIXME */
 
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  const all_knob_values_s* m_knob_values; /**< knob snapshot for hot paths */
 
 public:
   /**
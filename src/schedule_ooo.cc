@@ -62,6 +62,10 @@ schedule_ooo_c::schedule_ooo_c(int core_id, pqueue_c<int>** alloc_q, rob_c* rob,
   : schedule_c(exec, core_id, unit_type, frontend, alloc_q, simBase) {
   m_rob = rob;
   m_simBase = simBase;
+
+  std::fill_n(m_ready_mask, MASK_WORDS, 0);
+  std::fill_n(m_wait_mask, MASK_WORDS, 0);
+  std::fill_n(m_wait_next, MAX_SCHED_SIZE, -1);
 }
 
 // schedule_ooo_c destructor
@@ -70,6 +74,10 @@ schedule_ooo_c::~schedule_ooo_c(void) {
 
 // main execution routine
 // In every cycle, schedule uops from rob
+//   Only slots in m_ready_mask are tried. A slot that fails on its operands is
+//   parked on a watch of the done cycle it waits for (see wait()) and is moved
+//   back by wake_up() once that done cycle changes or is reached, so the issue
+//   order is the same as trying every slot from m_first_schlist_ptr.
 void schedule_ooo_c::run_a_cycle(void) {
   // Check if the schedule isn't running
   if (!is_running()) return;
@@ -81,34 +89,51 @@ void schedule_ooo_c::run_a_cycle(void) {
 
   int count = 0;
   if (m_num_in_sched) {
-    for (int i = m_first_schlist_ptr; i != m_last_schlist_ptr;
-         i = (i + 1) % MAX_SCHED_SIZE) {
-      if (m_schedule_list[i] != -1) {
-        SCHED_FAIL_TYPE sched_fail_reason;
-
-        // schedule un uop
-        if (uop_schedule(m_schedule_list[i], &sched_fail_reason)) {
-          STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS);
-          if (i == m_first_schlist_ptr) {
-            m_first_schlist_ptr = (m_first_schlist_ptr + 1) % MAX_SCHED_SIZE;
-          }
-
-          m_schedule_list[i] = -1;
-          ++count;
-
-          // schedule enough uops, break it
-          if (m_knob_sched_to_width && count >= m_knob_width) break;
-        } else {
-          // schedule has been failed for current uop
-          // try to find next available one
-          STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS +
-                                       MIN2(sched_fail_reason, 6));
+    wake_up();
+
+    int stop = m_last_schlist_ptr;
+    int num_parked = 0;
+    for (int i = find_slot(m_ready_mask, m_first_schlist_ptr, stop); i != -1;
+         i = find_slot(m_ready_mask, (i + 1) % MAX_SCHED_SIZE, stop)) {
+      SCHED_FAIL_TYPE sched_fail_reason;
+
+      // schedule un uop
+      if (uop_schedule(m_schedule_list[i], &sched_fail_reason)) {
+        STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS);
+
+        m_schedule_list[i] = -1;
+        m_ready_mask[i / 64] &= ~(1ULL << (i % 64));
+        ++count;
+
+        // schedule enough uops, break it
+        if (m_knob_sched_to_width && count >= m_knob_width) {
+          stop = (i + 1) % MAX_SCHED_SIZE;
+          break;
         }
-      } else if (i == m_first_schlist_ptr) {
-        m_first_schlist_ptr = (m_first_schlist_ptr + 1) % MAX_SCHED_SIZE;
+      } else {
+        // schedule has been failed for current uop
+        // try to find next available one
+        STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS +
+                                     MIN2(sched_fail_reason, 6));
+
+        if (sched_fail_reason == SCHED_FAIL_OPERANDS_NOT_READY && wait(i))
+          ++num_parked;
       }
     }
 
+    // slots that were already parked would have failed on their operands too
+    int num_waiting =
+      count_slots(m_wait_mask, m_first_schlist_ptr, stop) - num_parked;
+    if (num_waiting)
+      STAT_CORE_EVENT_N(m_core_id, SCHED_FAILED_OPERANDS_NOT_READY,
+                        num_waiting);
+
+    // remove scheduled uops at the head of the list
+    while (m_first_schlist_ptr != stop &&
+           m_schedule_list[m_first_schlist_ptr] == -1) {
+      m_first_schlist_ptr = (m_first_schlist_ptr + 1) % MAX_SCHED_SIZE;
+    }
+
     // no uop has been scheduled
     if (count == 0) STAT_CORE_EVENT(m_core_id, NUM_NO_SCHED_CYCLE);
   } else {
@@ -117,7 +142,218 @@ void schedule_ooo_c::run_a_cycle(void) {
   }
 
   // advance uops from alloc queue to schedule queue
+  int last = m_last_schlist_ptr;
   for (int i = 0; i < max_ALLOCQ; ++i) {
     this->advance(i);
   }
+
+  // new uops are tried from the next cycle
+  for (; last != m_last_schlist_ptr; last = (last + 1) % MAX_SCHED_SIZE) {
+    m_ready_mask[last / 64] |= 1ULL << (last % 64);
+  }
+}
+
+// move the slots of every watch whose done cycle has changed back to the ready mask
+void schedule_ooo_c::wake_up(void) {
+  for (int ii = 0; ii < (int)m_active_watch.size();) {
+    int index = m_active_watch[ii];
+    sched_watch_s* watch = &m_watch[index];
+
+    bool changed;
+    if (watch->m_src) {
+      // same source validity check as check_srcs()
+      uop_c* src_uop = watch->m_src;
+      changed = src_uop->m_done_cycle != 0 || !src_uop->m_valid ||
+                src_uop->m_uop_num != watch->m_src_num ||
+                src_uop->m_thread_id != watch->m_src_thread;
+    } else {
+      changed = *watch->m_done_cycle != watch->m_value ||
+                m_cur_core_cycle >= watch->m_value;
+    }
+
+    if (!changed) {
+      ++ii;
+      continue;
+    }
+
+    for (int slot = watch->m_head; slot != -1; slot = m_wait_next[slot]) {
+      m_wait_mask[slot / 64] &= ~(1ULL << (slot % 64));
+      m_ready_mask[slot / 64] |= 1ULL << (slot % 64);
+    }
+
+    auto itr = m_watch_map.find(watch->m_done_cycle);
+    if (itr != m_watch_map.end() && itr->second == index) m_watch_map.erase(itr);
+
+    m_free_watch.push_back(index);
+    m_active_watch[ii] = m_active_watch.back();
+    m_active_watch.pop_back();
+  }
+}
+
+// park a slot that failed on its operands
+//   While the watched done cycle is unchanged, uop_schedule() would keep
+//   failing on the same operand without updating the uop:
+//   - m_last_dep_exec in the future: the early check in uop_schedule() fails
+//   - otherwise check_srcs() stops at a source that has not been executed yet
+bool schedule_ooo_c::wait(int slot) {
+  uop_c* cur_uop = (*m_rob)[m_schedule_list[slot]];
+
+  sched_watch_s key;
+  key.m_src = NULL;
+  key.m_src_num = 0;
+  key.m_src_thread = 0;
+
+  if (cur_uop->m_last_dep_exec &&
+      m_cur_core_cycle < *(cur_uop->m_last_dep_exec)) {
+    key.m_done_cycle = cur_uop->m_last_dep_exec;
+    key.m_value = *(cur_uop->m_last_dep_exec);
+  } else {
+    for (int i = 0; i < cur_uop->m_num_srcs; ++i) {
+      uop_c* src_uop = cur_uop->m_map_src_info[i].m_uop;
+      if (!src_uop || !src_uop->m_valid ||
+          (src_uop->m_uop_num != cur_uop->m_map_src_info[i].m_uop_num) ||
+          (src_uop->m_thread_id != cur_uop->m_thread_id))
+        continue;
+
+      if (src_uop->m_done_cycle == 0 ||
+          m_cur_core_cycle < src_uop->m_done_cycle) {
+        key.m_src = src_uop;
+        break;
+      }
+    }
+
+    // a source with a known done cycle is always covered by m_last_dep_exec
+    if (!key.m_src || key.m_src->m_done_cycle != 0) return false;
+
+    key.m_done_cycle = &(key.m_src->m_done_cycle);
+    key.m_value = 0;
+    key.m_src_num = key.m_src->m_uop_num;
+    key.m_src_thread = key.m_src->m_thread_id;
+  }
+
+  // share the watch with other slots waiting for the same done cycle
+  int index = -1;
+  auto itr = m_watch_map.find(key.m_done_cycle);
+  if (itr != m_watch_map.end()) {
+    sched_watch_s* watch = &m_watch[itr->second];
+    if (watch->m_value == key.m_value && watch->m_src == key.m_src &&
+        watch->m_src_num == key.m_src_num &&
+        watch->m_src_thread == key.m_src_thread)
+      index = itr->second;
+  }
+
+  if (index == -1) {
+    if (m_free_watch.empty()) {
+      index = m_watch.size();
+      m_watch.push_back(key);
+    } else {
+      index = m_free_watch.back();
+      m_free_watch.pop_back();
+      m_watch[index] = key;
+    }
+    m_watch[index].m_head = -1;
+    m_active_watch.push_back(index);
+    m_watch_map[key.m_done_cycle] = index;
+  }
+
+  m_wait_next[slot] = m_watch[index].m_head;
+  m_watch[index].m_head = slot;
+  m_ready_mask[slot / 64] &= ~(1ULL << (slot % 64));
+  m_wait_mask[slot / 64] |= 1ULL << (slot % 64);
+
+  return true;
+}
+
+// first set slot in the circular range [from, to)
+int schedule_ooo_c::find_slot(const uns64* mask, int from, int to) {
+  if (from == to) return -1;
+
+  int end = (from < to) ? to : MAX_SCHED_SIZE;
+  while (true) {
+    for (int ii = from; ii < end;) {
+      uns64 word = mask[ii / 64] >> (ii % 64);
+      if (word) {
+        int slot = ii + __builtin_ctzll(word);
+        return (slot < end) ? slot : -1;
+      }
+      ii = (ii / 64 + 1) * 64;
+    }
+
+    // wrap around
+    if (end == to) return -1;
+    from = 0;
+    end = to;
+  }
+}
+
+// number of set slots in the circular range [from, to)
+int schedule_ooo_c::count_slots(const uns64* mask, int from, int to) {
+  if (from == to) return 0;
+
+  int count = 0;
+  int end = (from < to) ? to : MAX_SCHED_SIZE;
+  while (true) {
+    for (int ii = from; ii < end;) {
+      int next = MIN2((ii / 64 + 1) * 64, end);
+      uns64 word = mask[ii / 64] >> (ii % 64);
+      if (next - ii < 64) word &= (1ULL << (next - ii)) - 1;
+      count += __builtin_popcountll(word);
+      ii = next;
+    }
+
+    if (end == to) return count;
+    from = 0;
+    end = to;
+  }
+}
+
+// the scheduler is idle while every uop in it waits for a source that has not
+// been executed yet (a memory access) and the allocation queues are blocked
+Counter schedule_ooo_c::get_idle_cycles(void) {
+  if (m_simBase->m_core_pointers[m_core_id]->get_core_type_id() == CORE_IGPU)
+    return 0;
+
+  if (m_num_in_sched) {
+    for (int i = m_first_schlist_ptr; i != m_last_schlist_ptr;
+         i = (i + 1) % MAX_SCHED_SIZE) {
+      // an empty head slot will be removed
+      if (m_schedule_list[i] == -1) {
+        if (i == m_first_schlist_ptr) return 0;
+        continue;
+      }
+
+      uop_c* cur_uop = (*m_rob)[m_schedule_list[i]];
+      if (cur_uop->m_bogus || cur_uop->m_srcs_rdy) return 0;
+
+      // same source validity check as check_srcs()
+      bool waiting = false;
+      for (int j = 0; j < cur_uop->m_num_srcs; ++j) {
+        uop_c* src_uop = cur_uop->m_map_src_info[j].m_uop;
+        if (!src_uop || !src_uop->m_valid ||
+            (src_uop->m_uop_num != cur_uop->m_map_src_info[j].m_uop_num) ||
+            (src_uop->m_thread_id != cur_uop->m_thread_id))
+          continue;
+
+        if (src_uop->m_done_cycle == 0) {
+          waiting = true;
+          break;
+        }
+      }
+      if (!waiting) return 0;
+    }
+  }
+
+  // uops in the allocation queues cannot move to the scheduler
+  for (int i = 0; i < max_ALLOCQ; ++i) {
+    if (!m_alloc_q[i]->ready()) continue;
+
+    if ((m_last_schlist_ptr + 1) % MAX_SCHED_SIZE == m_first_schlist_ptr)
+      continue;
+
+    int entry = (int)m_alloc_q[i]->peek(0);
+    ALLOCQ_Type q_type = (*m_rob)[entry]->m_allocq_num;
+    if (m_num_per_sched[q_type] < m_sched_size[q_type]) return 0;
+  }
+
+  return ULLONG_MAX;
 }
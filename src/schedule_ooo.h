@@ -37,9 +37,28 @@ POSSIBILITY OF SUCH DAMAGE.
 #ifndef SCHEDULE_ORIG_H_INCLUDED
 #define SCHEDULE_ORIG_H_INCLUDED
 
+#include <unordered_map>
+#include <vector>
+
 #include "schedule.h"
 #include "uop.h"
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Wakeup watch shared by the scheduler entries blocked on the same producer
+///
+/// A timed watch (m_src == NULL) covers entries whose last dependent done cycle is
+/// still in the future. A producer watch covers entries blocked on a source uop that
+/// has not been executed yet.
+///////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct sched_watch_s {
+  Counter* m_done_cycle; /**< watched done cycle */
+  Counter m_value; /**< done cycle when the watch was set */
+  uop_c* m_src; /**< unexecuted source uop (producer watch) */
+  Counter m_src_num; /**< uop number of the source uop */
+  int m_src_thread; /**< thread id of the source uop */
+  int m_head; /**< first scheduler slot waiting on this watch */
+} sched_watch_s;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief Out-of-order (OOO) scheduler
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,8 +91,49 @@ public:
    */
   void run_a_cycle();
 
+  /*! \fn Counter get_idle_cycles()
+   *  \brief Function to check whether every uop waits for the memory system
+   *   and no uop can move from the allocation queues.
+   *  \return Counter - 0 if busy, ULLONG_MAX if waiting for others
+   */
+  Counter get_idle_cycles();
+
 private:
+  /**
+   *  \brief Wake up the entries whose watched producer has changed
+   *  \return void
+   */
+  void wake_up(void);
+
+  /**
+   *  \brief Park a scheduler slot that failed on its operands on a watch
+   *  \param slot - scheduler slot
+   *  \return bool - false if the slot has to be checked every cycle
+   */
+  bool wait(int slot);
+
+  /**
+   *  \brief Find the first set bit of a mask in the circular slot range [from, to)
+   *  \return int - slot index, -1 if none
+   */
+  int find_slot(const uns64* mask, int from, int to);
+
+  /**
+   *  \brief Count the set bits of a mask in the circular slot range [from, to)
+   *  \return int - number of slots
+   */
+  int count_slots(const uns64* mask, int from, int to);
+
   macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+
+  static const int MASK_WORDS = MAX_SCHED_SIZE / 64; /**< words per slot mask */
+  uns64 m_ready_mask[MASK_WORDS]; /**< slots checked every cycle */
+  uns64 m_wait_mask[MASK_WORDS]; /**< slots parked on a watch */
+  int m_wait_next[MAX_SCHED_SIZE]; /**< next slot parked on the same watch */
+  vector<sched_watch_s> m_watch; /**< watch pool */
+  vector<int> m_free_watch; /**< free watch indices */
+  vector<int> m_active_watch; /**< watches polled every cycle */
+  unordered_map<Counter*, int> m_watch_map; /**< done cycle to latest watch */
 };
 
 #endif  // SCHEDULE_ORIG_H_INCLUDED
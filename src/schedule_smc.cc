@@ -60,6 +60,8 @@ POSSIBILITY OF SUCH DAMAGE.
 /// for these reasons, the scheduler is implemented as a list of scheduler
 /// queues. each thread is assigned a queue when the thread (block) is assigned
 /// to the core. when the thread terminates, the queue is freed.
+/// each warp scheduler keeps its threads sorted by their oldest waiting uop,
+/// so a schedule cycle visits threads instead of every waiting uop.
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
 struct Uop_Dispatch_Latency {
@@ -99,15 +101,16 @@ schedule_smc_c::schedule_smc_c(int core_id,
 
   m_schedule_modulo = *KNOB(KNOB_GPU_SCHEDULE_RATIO) - 1;
   m_schlist_size = MAX_GPU_SCHED_SIZE * knob_num_threads;
-  m_schlist_entry = new int[m_schlist_size];
-  m_schlist_tid = new int[m_schlist_size];
-  m_first_schlist = 0;
-  m_last_schlist = 0;
+  m_first_seq = 0;
+  m_last_seq = 0;
+  m_warp_order.resize(*KNOB(KNOB_NUM_WARP_SCHEDULER));
   m_dispatch_busy_cycle = new Counter[*KNOB(KNOB_NUM_WARP_SCHEDULER)];
   fill_n(m_dispatch_busy_cycle,
          m_simBase->m_knobs->KNOB_NUM_WARP_SCHEDULER->getValue(), 0);
   m_sfu_dispatch_busy_cycle = 0;
 
+  // uop types that are not in the table are dispatched without delay
+  fill_n(m_dispatch_latency, static_cast<size_t>(NUM_UOP_TYPES), 0);
   int factor = *KNOB(KNOB_PTX_DISPATCH_LATENCY_FACTOR);
   int latency_array_size =
     (sizeof(uop_dispatch_latency_ptx) / sizeof(uop_dispatch_latency_ptx[0]));
@@ -120,8 +123,11 @@ schedule_smc_c::schedule_smc_c(int core_id,
 
 // schedule_smc_c destructor
 schedule_smc_c::~schedule_smc_c(void) {
-  delete[] m_schlist_entry;
-  delete[] m_schlist_tid;
+  for (auto itr = m_warp_queue.begin(); itr != m_warp_queue.end(); ++itr)
+    delete itr->second;
+  for (auto itr = m_free_warp_queue.begin(); itr != m_free_warp_queue.end();
+       ++itr)
+    delete *itr;
 }
 
 // move uops from alloc queue to schedule queue
@@ -130,7 +136,8 @@ void schedule_smc_c::advance(int q_index) {
 
   while (m_gpu_allocq[q_index]->ready()) {
     // this prevents scheduler overwritten
-    if ((m_last_schlist + 1) % m_schlist_size == m_first_schlist) break;
+    if (m_last_seq - m_first_seq == static_cast<Counter>(m_schlist_size - 1))
+      break;
 
     gpu_allocq_entry_s allocq_entry = m_gpu_allocq[q_index]->peek(0);
 
@@ -177,15 +184,28 @@ void schedule_smc_c::advance(int q_index) {
     cur_uop->m_in_iaq = false;
     cur_uop->m_in_scheduler = true;
 
-    //    int queue = get_reserved_sched_queue(allocq_entry.m_thread_id);
-    int entry = allocq_entry.m_rob_entry;
-
-    m_schlist_entry[m_last_schlist] = entry;
-    m_schlist_tid[m_last_schlist++] = tid;
-    m_last_schlist %= m_schlist_size;
+    // append to the thread's queue; a thread that had nothing waiting
+    // becomes the youngest one of its warp scheduler
+    smc_sched_entry_s sched_entry = {allocq_entry.m_rob_entry, m_last_seq++};
+    ring_queue_c<smc_sched_entry_s> *queue = m_warp_queue[tid];
+    if (queue == NULL || queue->empty()) {
+      if (queue == NULL) {
+        if (m_free_warp_queue.empty()) {
+          queue = new ring_queue_c<smc_sched_entry_s>();
+          queue->reserve(MAX_GPU_SCHED_SIZE);
+        } else {
+          queue = m_free_warp_queue.back();
+          m_free_warp_queue.pop_back();
+        }
+        m_warp_queue[tid] = queue;
+      }
+      smc_warp_order_s order = {sched_entry.m_seq, tid, queue};
+      m_warp_order[tid % m_warp_order.size()].push_back(order);
+    }
+    queue->push_back(sched_entry);
     ++m_num_in_sched;
     ++m_num_per_sched[allocq];
-    assert(m_last_schlist != m_first_schlist);
+    assert(m_last_seq - m_first_seq < static_cast<Counter>(m_schlist_size));
 
     DEBUG("core_id:%d thread_id:%d uop_num:%lld inserted into scheduler\n",
           m_core_id, cur_uop->m_thread_id, cur_uop->m_uop_num);
@@ -305,7 +325,7 @@ bool schedule_smc_c::uop_schedule_smc(int thread_id, int entry,
 
     // check available mshr spaces for scheduling
     core_c *core = m_simBase->m_core_pointers[m_core_id];
-    if ((("ptx" == core->get_core_type()) || (core->get_core_type() == "nvbit") )&& cur_uop->m_mem_type != NOT_MEM &&
+    if (core->is_nvidia_core() && cur_uop->m_mem_type != NOT_MEM &&
         cur_uop->m_num_child_uops > 0) {
       // constant or texture memory access
       if (cur_uop->m_mem_type == MEM_LD_CM ||
@@ -388,7 +408,6 @@ bool schedule_smc_c::uop_schedule_smc(int thread_id, int entry,
   return true;
 }
 
-#if 1
 // main execution routine
 // In every cycle, schedule uops from rob
 void schedule_smc_c::run_a_cycle(void) {
@@ -400,7 +419,8 @@ void schedule_smc_c::run_a_cycle(void) {
   m_cur_core_cycle = m_simBase->m_core_cycle[m_core_id];
 
   // GPU : schedule every N cycles (G80:4, Fermi:2)
-  m_schedule_modulo = (m_schedule_modulo + 1) % *KNOB(KNOB_GPU_SCHEDULE_RATIO);
+  m_schedule_modulo =
+    (m_schedule_modulo + 1) % KNOB_VALUE(KNOB_GPU_SCHEDULE_RATIO);
   if (m_schedule_modulo) return;
 
   // clear execution port
@@ -410,180 +430,87 @@ void schedule_smc_c::run_a_cycle(void) {
   // can schedule instructions from different threads. We enforce threads selected by
   // each warp scheduler should be different.
   int count = 0;
-  int num_schedulers = *KNOB(KNOB_NUM_WARP_SCHEDULER);
-  int round_count;
-  int inst_per_sched = 1;
+  int num_schedulers = KNOB_VALUE(KNOB_NUM_WARP_SCHEDULER);
   for (int sched_id = m_next_sched_id, sched_count = 0;
        sched_count < num_schedulers;
        sched_id = (sched_id + 1) % num_schedulers, ++sched_count) {
     if (m_dispatch_busy_cycle[sched_id] > m_cur_core_cycle) {
       continue;
     }
-    round_count = 0;
-    for (int ii = m_first_schlist; ii != m_last_schlist;
-         ii = (ii + 1) % m_schlist_size) {
-      // -------------------------------------
-      // Schedule stops when
-      // 1) no uops in the scheduler (m_num_in_sched and first == last)
-      // 2) # warp scheduler
-      // 3) FIXME add width condition
-      // -------------------------------------
-      if (!m_num_in_sched || m_first_schlist == m_last_schlist) break;
-
-      SCHED_FAIL_TYPE sched_fail_reason;
 
-      int thread_id = m_schlist_tid[ii];
-      int entry = m_schlist_entry[ii];
-      bool sfu_inst;
+    // no uops in the scheduler
+    if (!m_num_in_sched || m_first_seq == m_last_seq) continue;
 
-      if (thread_id != -1 && (thread_id % num_schedulers) != sched_id) {
-        continue;
-      }
-
-      bool uop_scheduled = false;
-
-      if (entry != -1) {
-        if (m_processed_threads.find(thread_id) != m_processed_threads.end()) {
-          continue;
-        }
-
-        m_processed_threads[thread_id] = 1;
-
-        {
-          rob_c *thread_m_rob = m_gpu_rob->get_thread_rob(thread_id);
-          uop_c *cur_uop = (*thread_m_rob)[entry];
-
-          sfu_inst = is_sfu_inst(cur_uop);
-          if (sfu_inst && m_sfu_dispatch_busy_cycle > m_cur_core_cycle) {
-            continue;
-          }
-        }
-
-        // cout << m_cur_core_cycle << " trying " << setw(3) << thread_id << "\n";
-
-        // schedule a uop from a thread
-        if (uop_schedule_smc(thread_id, entry, &sched_fail_reason)) {
-          STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS);
-
-          m_schlist_entry[ii] = -1;
-          m_schlist_tid[ii] = -1;
-          if (ii == m_first_schlist) {
-            m_first_schlist = (m_first_schlist + 1) % m_schlist_size;
-          }
-
-          uop_scheduled = true;
-          ++count;
-
-          {
-            rob_c *thread_m_rob = m_gpu_rob->get_thread_rob(thread_id);
-            uop_c *cur_uop = (*thread_m_rob)[entry];
-            /*
-            cout << m_cur_core_cycle << " "
-                 << sched_id << " "
-                 << thread_id << " "
-                 << sfu_inst << " "
-                 << m_dispatch_latency[cur_uop->m_uop_type] << "\n";
-            */
-
-            if (sfu_inst) {
-              m_sfu_dispatch_busy_cycle =
-                m_cur_core_cycle + m_dispatch_latency[cur_uop->m_uop_type];
-            } else {
-              m_dispatch_busy_cycle[sched_id] =
-                m_cur_core_cycle + m_dispatch_latency[cur_uop->m_uop_type];
-            }
-          }
-          ++round_count;
-          if (round_count == inst_per_sched) {
-            break;
-          }
-        } else {
-          STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS +
-                                       MIN2(sched_fail_reason, 6));
-        }
-      } else if (ii == m_first_schlist) {
-        m_first_schlist = (m_first_schlist + 1) % m_schlist_size;
-      }
-    }
-  }
-
-  m_next_sched_id = (m_next_sched_id + 1) % num_schedulers;
-  // no uop is scheduled in this cycle
-  if (count == 0) {
-    STAT_CORE_EVENT(m_core_id, NUM_NO_SCHED_CYCLE);
-    STAT_EVENT(AVG_CORE_IDLE_CYCLE);
-  }
-
-  m_processed_threads.clear();
-
-  // advance entries from alloc queue to schedule queue
-  for (int ii = 0; ii < max_ALLOCQ; ++ii) {
-    advance(ii);
-  }
-}
-#else
-// main execution routine
-// In every cycle, schedule uops from rob
-void schedule_smc_c::run_a_cycle(void) {
-  // check if the scheduler is running
-  if (!is_running()) {
-    return;
-  }
-
-  m_cur_core_cycle = m_simBase->m_core_cycle[m_core_id];
-
-  // GPU : schedule every N cycles (G80:4, Fermi:2)
-  m_schedule_modulo = (m_schedule_modulo + 1) % *KNOB(KNOB_GPU_SCHEDULE_RATIO);
-  if (m_schedule_modulo) return;
-
-  // clear execution port
-  m_exec->clear_ports();
-
-  // GPU : recent GPUs have dual warp schedulers. In each schedule cycle, each warp scheduler
-  // can schedule instructions from different threads. We enforce threads selected by
-  // each warp scheduler should be different.
-  int count = 0;
-  for (int ii = m_first_schlist; ii != m_last_schlist;
-       ii = (ii + 1) % m_schlist_size) {
     // -------------------------------------
-    // Schedule stops when
-    // 1) no uops in the scheduler (m_num_in_sched and first == last)
-    // 2) # warp scheduler
-    // 3) FIXME add width condition
+    // only the oldest uop of each thread can be scheduled (in-order). threads
+    // are tried from the one with the oldest waiting uop; one uop is
+    // scheduled per warp scheduler
     // -------------------------------------
-    if (!m_num_in_sched || m_first_schlist == m_last_schlist ||
-        count == *KNOB(KNOB_NUM_WARP_SCHEDULER))
-      break;
+    Counter oldest_seq = get_oldest_seq();
+    Counter scheduled_seq = 0;
+    bool uop_scheduled = false;
+    vector<smc_warp_order_s> &warp_order = m_warp_order[sched_id];
+    for (int ii = 0; ii < static_cast<int>(warp_order.size()); ++ii) {
+      SCHED_FAIL_TYPE sched_fail_reason;
 
-    SCHED_FAIL_TYPE sched_fail_reason;
+      int thread_id = warp_order[ii].m_thread_id;
+      ring_queue_c<smc_sched_entry_s> *queue = warp_order[ii].m_queue;
+      int entry = queue->front().m_entry;
 
-    int thread_id = m_schlist_tid[ii];
-    int entry = m_schlist_entry[ii];
+      rob_c *thread_m_rob = m_gpu_rob->get_thread_rob(thread_id);
+      uop_c *cur_uop = (*thread_m_rob)[entry];
 
-    bool uop_scheduled = false;
+      bool sfu_inst = is_sfu_inst(cur_uop);
+      if (sfu_inst && m_sfu_dispatch_busy_cycle > m_cur_core_cycle) {
+        continue;
+      }
 
-    if (entry != -1) {
       // schedule a uop from a thread
       if (uop_schedule_smc(thread_id, entry, &sched_fail_reason)) {
         STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS);
 
-        m_schlist_entry[ii] = -1;
-        m_schlist_tid[ii] = -1;
-        if (ii == m_first_schlist) {
-          m_first_schlist = (m_first_schlist + 1) % m_schlist_size;
+        // the thread moves to the position of its next waiting uop
+        scheduled_seq = warp_order[ii].m_seq;
+        queue->pop_front();
+        warp_order.erase(warp_order.begin() + ii);
+        if (queue->empty()) {
+          m_warp_queue.erase(thread_id);
+          m_free_warp_queue.push_back(queue);
+        } else {
+          smc_warp_order_s order = {queue->front().m_seq, thread_id, queue};
+          int pos = ii;
+          while (pos < static_cast<int>(warp_order.size()) &&
+                 warp_order[pos].m_seq < order.m_seq)
+            ++pos;
+          warp_order.insert(warp_order.begin() + pos, order);
         }
 
         uop_scheduled = true;
         ++count;
+
+        if (sfu_inst) {
+          m_sfu_dispatch_busy_cycle =
+            m_cur_core_cycle + m_dispatch_latency[cur_uop->m_uop_type];
+        } else {
+          m_dispatch_busy_cycle[sched_id] =
+            m_cur_core_cycle + m_dispatch_latency[cur_uop->m_uop_type];
+        }
+        break;
       } else {
-        STAT_CORE_EVENT(
-          m_core_id, SCHED_FAILED_REASON_SUCCESS + MIN2(sched_fail_reason, 5));
+        STAT_CORE_EVENT(m_core_id, SCHED_FAILED_REASON_SUCCESS +
+                                     MIN2(sched_fail_reason, 6));
       }
-    } else if (ii == m_first_schlist) {
-      m_first_schlist = (m_first_schlist + 1) % m_schlist_size;
     }
+
+    // the head of the schedule list passes scheduled entries only up to the
+    // oldest uop that is still waiting (or just behind the scheduled one)
+    if (uop_scheduled && scheduled_seq == oldest_seq)
+      m_first_seq = scheduled_seq + 1;
+    else
+      m_first_seq = oldest_seq;
   }
 
+  m_next_sched_id = (m_next_sched_id + 1) % num_schedulers;
   // no uop is scheduled in this cycle
   if (count == 0) {
     STAT_CORE_EVENT(m_core_id, NUM_NO_SCHED_CYCLE);
@@ -595,7 +522,16 @@ void schedule_smc_c::run_a_cycle(void) {
     advance(ii);
   }
 }
-#endif
+
+// sequence number of the oldest uop waiting in any warp scheduler
+Counter schedule_smc_c::get_oldest_seq(void) {
+  Counter oldest_seq = m_last_seq;
+  for (auto itr = m_warp_order.begin(); itr != m_warp_order.end(); ++itr) {
+    if (!itr->empty() && itr->front().m_seq < oldest_seq)
+      oldest_seq = itr->front().m_seq;
+  }
+  return oldest_seq;
+}
 
 bool schedule_smc_c::is_sfu_inst(uop_c *uop) {
   if (uop->m_uop_type == UOP_GPU_FCOS || uop->m_uop_type == UOP_GPU_FEX2 ||
@@ -37,7 +37,10 @@ POSSIBILITY OF SUCH DAMAGE.
 #ifndef SCHEDULE_ORIG_GPU_H_INCLUDED
 #define SCHEDULE_ORIG_GPU_H_INCLUDED
 
+#include <unordered_map>
+
 #include "rob.h"
+#include "ring_queue.h"
 #include "schedule.h"
 #include "uop.h"
 #include "frontend.h"
@@ -108,20 +111,42 @@ private:
    */
   bool is_sfu_inst(uop_c* uop);
 
+  /*! \fn Counter get_oldest_seq(void)
+   *  \brief Function to get the oldest uop still waiting in the scheduler
+   *  \return Counter - Insertion sequence number of the oldest uop
+   */
+  Counter get_oldest_seq(void);
+
 private:
+  /**< uop waiting in a warp's scheduler queue */
+  typedef struct smc_sched_entry_s {
+    int m_entry; /**< rob entry */
+    Counter m_seq; /**< insertion order into the scheduler */
+  } smc_sched_entry_s;
+
+  /**< warp with waiting uops, ordered by its oldest uop */
+  typedef struct smc_warp_order_s {
+    Counter m_seq; /**< sequence number of the oldest waiting uop */
+    int m_thread_id; /**< thread id */
+    ring_queue_c<smc_sched_entry_s>* m_queue; /**< waiting uops of the warp */
+  } smc_warp_order_s;
+
+
   static const int MAX_GPU_SCHED_SIZE = 128; /**< max sched table size */
 
   smc_rob_c* m_gpu_rob; /**< gpu rob */
   pqueue_c<gpu_allocq_entry_s>** m_gpu_allocq; /**< gpu allocation queue */
   int knob_num_threads; /**< number of maximum thread per core */
   int m_schedule_modulo; /**< modulo to schedule next thread */
-  int* m_schlist_entry; /**< schedule list entry */
-  int* m_schlist_tid; /**< schedule list thread id */
-  int m_first_schlist; /**< current index in schedule list */
-  int m_last_schlist; /**< last index in schedule list */
+  unordered_map<int, ring_queue_c<smc_sched_entry_s>*>
+    m_warp_queue; /**< waiting uops of each warp, oldest first */
+  vector<ring_queue_c<smc_sched_entry_s>*>
+    m_free_warp_queue; /**< queues of warps that left the scheduler */
+  vector<vector<smc_warp_order_s> >
+    m_warp_order; /**< warps of each warp scheduler sorted by oldest uop */
+  Counter m_first_seq; /**< head of the schedule list (sequence number) */
+  Counter m_last_seq; /**< tail of the schedule list (sequence number) */
   int m_schlist_size; /**< schedule list size */
-  map<int, int>
-    m_processed_threads; /**<to track threads which have already been examined by the scheduler */
   Counter*
     m_dispatch_busy_cycle; /**<model the variable throughputs of different instructions */
   Counter
@@ -0,0 +1,159 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : stat_interval.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Periodic statistics snapshots (binary interval file)
+ *********************************************************************************************/
+
+#include <cstring>
+#include <sys/stat.h>
+
+#include "stat_interval.h"
+#include "assert_macros.h"
+#include "macsim.h"
+
+#include "all_knobs.h"
+#include "statistics.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// append an unsigned LEB128 varint
+static inline void put_varint(std::vector<char>& dst, uint64_t value) {
+  while (value >= 0x80) {
+    dst.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  dst.push_back(static_cast<char>(value));
+}
+
+// stat_interval_c constructor
+stat_interval_c::stat_interval_c(macsim_c* simBase) {
+  m_simBase = simBase;
+  m_file = NULL;
+  m_cycle_interval = *KNOB(KNOB_STAT_INTERVAL_CYCLES);
+  m_inst_interval = *KNOB(KNOB_STAT_INTERVAL_INSTS);
+  m_next_cycle = m_cycle_interval;
+  m_next_inst = m_inst_interval;
+
+  if (!m_cycle_interval && !m_inst_interval) return;
+
+  string path = KNOB(KNOB_STATISTICS_OUT_DIRECTORY)->getValue();
+  mkdir(path.c_str(), S_IRWXU);
+  path += "/" + KNOB(KNOB_STAT_INTERVAL_FILE)->getValue();
+
+  m_file = fopen(path.c_str(), "wb");
+  if (m_file == NULL) ASSERTM(0, "cannot create %s\n", path.c_str());
+
+  vector<string> global_names;
+  vector<string> core_names;
+  m_simBase->m_ProcessorStats->getNames(&global_names, &core_names);
+
+  stat_interval_header_s header;
+  header.m_magic = STAT_INTERVAL_MAGIC;
+  header.m_version = STAT_INTERVAL_VERSION;
+  header.m_num_global = global_names.size();
+  header.m_num_core = m_simBase->m_ProcessorStats->numCores();
+  header.m_num_core_stat = core_names.size();
+  header.m_reserved = 0;
+  fwrite(&header, sizeof(header), 1, m_file);
+
+  for (auto I = global_names.begin(), E = global_names.end(); I != E; ++I)
+    write_name(*I);
+  for (auto I = core_names.begin(), E = core_names.end(); I != E; ++I)
+    write_name(*I);
+  fflush(m_file);
+
+  m_prev.assign(header.m_num_global + header.m_num_core * header.m_num_core_stat, 0);
+}
+
+// stat_interval_c destructor
+stat_interval_c::~stat_interval_c() {
+  if (m_file) fclose(m_file);
+}
+
+// write a name
+void stat_interval_c::write_name(const std::string& name) {
+  uint16_t length = name.size();
+  fwrite(&length, sizeof(length), 1, m_file);
+  fwrite(name.data(), 1, length, m_file);
+}
+
+// append a snapshot of all stats
+void stat_interval_c::dump(uint64_t cycle, uint64_t num_inst) {
+  m_simBase->m_ProcessorStats->getCounts(&m_counts);
+  ASSERT(m_counts.size() == m_prev.size());
+
+  int num_changed = 0;
+  for (unsigned ii = 0; ii < m_counts.size(); ++ii) {
+    if (m_counts[ii] != m_prev[ii]) ++num_changed;
+  }
+
+  // payload size is patched in once the snapshot is encoded
+  m_buffer.assign(sizeof(uint32_t), 0);
+  put_varint(m_buffer, cycle);
+  put_varint(m_buffer, num_inst);
+  put_varint(m_buffer, num_changed);
+
+  unsigned last = 0;
+  for (unsigned ii = 0; ii < m_counts.size(); ++ii) {
+    if (m_counts[ii] == m_prev[ii]) continue;
+
+    // counters may also be decremented: zigzag-encode the signed change
+    int64_t delta = static_cast<int64_t>(m_counts[ii] - m_prev[ii]);
+    put_varint(m_buffer, ii - last);
+    put_varint(m_buffer, (static_cast<uint64_t>(delta) << 1) ^ (delta >> 63));
+    last = ii;
+  }
+
+  uint32_t size = m_buffer.size() - sizeof(uint32_t);
+  memcpy(m_buffer.data(), &size, sizeof(size));
+  fwrite(m_buffer.data(), 1, m_buffer.size(), m_file);
+  fflush(m_file);
+
+  m_prev.swap(m_counts);
+
+  // idle cycle skipping can jump over several boundaries
+  if (m_cycle_interval) m_next_cycle = (cycle / m_cycle_interval + 1) * m_cycle_interval;
+  if (m_inst_interval) m_next_inst = (num_inst / m_inst_interval + 1) * m_inst_interval;
+}
+
+// write the last snapshot and close the file
+void stat_interval_c::finalize(uint64_t cycle, uint64_t num_inst) {
+  if (m_file == NULL) return;
+
+  // end-of-simulation adjustments (e.g. sampling extrapolation) are included
+  dump(cycle, num_inst);
+
+  fclose(m_file);
+  m_file = NULL;
+  m_next_cycle = 0;
+  m_next_inst = 0;
+}
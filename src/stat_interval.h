@@ -0,0 +1,140 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : stat_interval.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Periodic statistics snapshots (binary interval file)
+ *********************************************************************************************/
+
+#ifndef STAT_INTERVAL_H_INCLUDED
+#define STAT_INTERVAL_H_INCLUDED
+
+#include <cstdio>
+#include <inttypes.h>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// Interval file layout
+///
+/// header | global stat names | per-core stat names | snapshot 0 | snapshot 1 | ...
+///
+/// Names are stored as a uint16_t length followed by the characters; per-core stats are named
+/// once, without the _CORE_<n> suffix. The counters of a snapshot are ordered like
+/// ProcessorStatistics::getCounts(): all global stats, then the per-core stats of core 0, 1, ..
+///
+/// snapshot : uint32_t payload size | payload
+/// payload  : varint cycle | varint retired instructions | varint number of changed counters |
+///            (varint index gap, zigzag varint delta) for every changed counter
+///
+/// Deltas are relative to the previous snapshot (the first one to zero) and index gaps to the
+/// previous changed counter, so unchanged counters cost nothing. Every snapshot is flushed
+/// when it is written; a file cut short by a killed run ends with at most one partial
+/// snapshot, which readers drop. tools/stat_interval_reader converts the file to CSV.
+///////////////////////////////////////////////////////////////////////////////////////////////
+#define STAT_INTERVAL_MAGIC 0x5649534d  // "MSIV"
+#define STAT_INTERVAL_VERSION 1
+
+typedef struct stat_interval_header_s {
+  uint32_t m_magic; /**< STAT_INTERVAL_MAGIC */
+  uint32_t m_version; /**< format version */
+  uint32_t m_num_global; /**< number of global stats */
+  uint32_t m_num_core; /**< number of cores */
+  uint32_t m_num_core_stat; /**< number of stats per core */
+  uint32_t m_reserved; /**< reserved */
+} stat_interval_header_s;
+
+class macsim_c;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Interval statistics writer
+///
+/// Takes a snapshot of all stat counters every KNOB_STAT_INTERVAL_CYCLES cycles and/or
+/// KNOB_STAT_INTERVAL_INSTS retired instructions, plus a final one at the end of the
+/// simulation. When both knobs are 0 nothing is written.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class stat_interval_c
+{
+public:
+  /**
+   * Constructor (opens <out>/<stat_interval_file> when an interval is set)
+   */
+  stat_interval_c(macsim_c* simBase);
+
+  /**
+   * Destructor
+   */
+  ~stat_interval_c();
+
+  /**
+   * Check whether a snapshot is due (called every cycle)
+   */
+  inline bool due(uint64_t cycle, uint64_t num_inst) {
+    return (m_next_cycle && cycle >= m_next_cycle) ||
+           (m_next_inst && num_inst >= m_next_inst);
+  }
+
+  /**
+   * Cycle of the next cycle-based snapshot (0: off)
+   */
+  inline uint64_t get_next_cycle(void) {
+    return m_next_cycle;
+  }
+
+  /**
+   * Append a snapshot of all stats and schedule the next one
+   */
+  void dump(uint64_t cycle, uint64_t num_inst);
+
+  /**
+   * Write the last snapshot and close the file
+   */
+  void finalize(uint64_t cycle, uint64_t num_inst);
+
+private:
+  stat_interval_c();  // do not implement
+
+  /**
+   * Write a name (uint16_t length + characters)
+   */
+  void write_name(const std::string& name);
+
+  macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+  FILE* m_file; /**< interval file (NULL: off) */
+  uint64_t m_cycle_interval; /**< cycles between snapshots (0: off) */
+  uint64_t m_inst_interval; /**< retired instructions between snapshots (0: off) */
+  uint64_t m_next_cycle; /**< cycle of the next snapshot (0: off) */
+  uint64_t m_next_inst; /**< instruction count of the next snapshot (0: off) */
+  std::vector<unsigned long long> m_prev; /**< counters at the last snapshot */
+  std::vector<unsigned long long> m_counts; /**< current counters */
+  std::vector<char> m_buffer; /**< snapshot encoding buffer */
+};
+
+#endif  // STAT_INTERVAL_H_INCLUDED
@@ -407,6 +407,67 @@ void ProcessorStatistics::setNumCores(unsigned int numCores) {
   }
 }
 
+// copy current counts of all stats
+void ProcessorStatistics::getCounts(vector<unsigned long long>* counts) const {
+  counts->clear();
+  for (int ii = 0; ii < m_globalStatistics->size(); ++ii)
+    counts->push_back((*m_globalStatistics)[ii].getCount());
+
+  for (auto I = m_allCoresStats.begin(), E = m_allCoresStats.end(); I != E;
+       ++I) {
+    for (int ii = 0; ii < (*I)->size(); ++ii)
+      counts->push_back((**I)[ii].getCount());
+  }
+}
+
+// names of all stats in getCounts() order (per-core stats once, without suffix)
+void ProcessorStatistics::getNames(vector<string>* global_names,
+                                   vector<string>* core_names) const {
+  global_names->clear();
+  for (int ii = 0; ii < m_globalStatistics->size(); ++ii)
+    global_names->push_back((*m_globalStatistics)[ii].getName());
+
+  core_names->clear();
+  if (m_allCoresStats.empty()) return;
+  for (int ii = 0; ii < m_allCoresStats[0]->size(); ++ii)
+    core_names->push_back((*m_allCoresStats[0])[ii].getName());
+}
+
+// replay the change since base repeat times (unsigned arithmetic also handles
+// stats that have been decremented)
+void ProcessorStatistics::repeatDelta(const vector<unsigned long long>& base,
+                                      unsigned long long repeat) {
+  unsigned int index = 0;
+  for (int ii = 0; ii < m_globalStatistics->size(); ++ii, ++index) {
+    AbstractStat& stat = (*m_globalStatistics)[ii];
+    stat.add((stat.getCount() - base[index]) * repeat);
+  }
+
+  for (auto I = m_allCoresStats.begin(), E = m_allCoresStats.end(); I != E;
+       ++I) {
+    for (int ii = 0; ii < (*I)->size(); ++ii, ++index) {
+      AbstractStat& stat = (**I)[ii];
+      stat.add((stat.getCount() - base[index]) * repeat);
+    }
+  }
+}
+
+void ProcessorStatistics::setCounts(const vector<unsigned long long>& counts) {
+  unsigned int index = 0;
+  for (int ii = 0; ii < m_globalStatistics->size(); ++ii, ++index) {
+    AbstractStat& stat = (*m_globalStatistics)[ii];
+    stat.add(counts[index] - stat.getCount());
+  }
+
+  for (auto I = m_allCoresStats.begin(), E = m_allCoresStats.end(); I != E;
+       ++I) {
+    for (int ii = 0; ii < (*I)->size(); ++ii, ++index) {
+      AbstractStat& stat = (**I)[ii];
+      stat.add(counts[index] - stat.getCount());
+    }
+  }
+}
+
 // dump out all stats
 void ProcessorStatistics::saveStats() {
   saveStats("");
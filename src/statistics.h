@@ -194,6 +194,13 @@ public:
     m_count += delta;
   }
 
+  /**
+   * Increase the counter by a 64-bit delta.
+   */
+  inline void add(unsigned long long delta) {
+    m_count += delta;
+  }
+
   /**
    * Get the value of the counter.
    */
@@ -950,6 +957,13 @@ public:
     return pClone;
   }
 
+  /**
+   * Return number of core stats.
+   */
+  int size() const {
+    return m_CoreStats.size();
+  }
+
   /**
    * Display all stats in the standard output.
    */
@@ -1038,6 +1052,39 @@ public:
    */
   void saveStats(string ext);
 
+  /**
+   * Copy current counts of all global and core stats.
+   * @param counts vector to fill
+   */
+  void getCounts(vector<unsigned long long>* counts) const;
+
+  /**
+   * Names of the global stats and of the per-core stats (without the core suffix),
+   * in getCounts() order.
+   */
+  void getNames(vector<string>* global_names, vector<string>* core_names) const;
+
+  /**
+   * Number of cores with per-core stats.
+   */
+  unsigned int numCores() const {
+    return m_allCoresStats.size();
+  }
+
+  /**
+   * Add the change since a previous getCounts() to every stat repeat times.
+   * @param base counts returned by getCounts()
+   * @param repeat number of times to apply the change
+   */
+  void repeatDelta(const vector<unsigned long long>& base,
+                   unsigned long long repeat);
+
+  /**
+   * Overwrite every stat with counts returned by getCounts().
+   * @param counts counts of all global and core stats
+   */
+  void setCounts(const vector<unsigned long long>& counts);
+
   /**
    * Print all stats after the simulation.
    */
@@ -0,0 +1,284 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : sweep.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Parameter sweep (many configurations from one trace pass)
+ *********************************************************************************************/
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+#include <thread>
+#include <zlib.h>
+
+#include "sweep.h"
+#include "block_trace.h"
+#include "macsim.h"
+
+#define SWEEP_READ_SIZE (1 << 20)
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// one configuration of a sweep
+typedef struct sweep_config_s {
+  std::string m_out; /**< output directory */
+  std::vector<std::string> m_args; /**< knob overrides of this configuration */
+} sweep_config_s;
+
+// check whether the command line requests a sweep
+bool sweep_requested(int argc, char** argv) {
+  for (int ii = 1; ii < argc; ++ii) {
+    if (!strncmp(argv[ii], "--sweep=", 8)) return true;
+  }
+  return false;
+}
+
+// parse the sweep file
+static bool read_sweep_file(const std::string& filename,
+                            std::vector<sweep_config_s>& configs) {
+  std::ifstream file(filename.c_str());
+  if (!file.is_open()) return false;
+
+  std::string line;
+  while (std::getline(file, line)) {
+    size_t comment = line.find('#');
+    if (comment != std::string::npos) line.erase(comment);
+
+    std::istringstream tokens(line);
+    sweep_config_s config;
+    if (!(tokens >> config.m_out)) continue;
+
+    std::string arg;
+    while (tokens >> arg) config.m_args.push_back(arg);
+    configs.push_back(config);
+  }
+
+  return true;
+}
+
+// run all configurations of a sweep
+int run_sweep(int argc, char** argv) {
+  std::string sweep_file;
+  int num_threads = 0;
+  std::vector<std::string> common_args;
+  for (int ii = 1; ii < argc; ++ii) {
+    if (!strncmp(argv[ii], "--sweep=", 8))
+      sweep_file = argv[ii] + 8;
+    else if (!strncmp(argv[ii], "--sweep_threads=", 16))
+      num_threads = atoi(argv[ii] + 16);
+    else
+      common_args.push_back(argv[ii]);
+  }
+
+  std::vector<sweep_config_s> configs;
+  if (!read_sweep_file(sweep_file, configs)) {
+    std::cerr << "sweep: cannot open " << sweep_file << "\n";
+    return 1;
+  }
+  if (configs.empty()) {
+    std::cerr << "sweep: no configuration in " << sweep_file << "\n";
+    return 1;
+  }
+
+  int num_config = configs.size();
+  if (num_threads <= 0) num_threads = std::thread::hardware_concurrency();
+  if (num_threads <= 0) num_threads = 1;
+  if (num_threads > num_config) num_threads = num_config;
+
+  std::cout << "sweep: " << num_config << " configurations on " << num_threads
+            << " host threads\n";
+
+  trace_store_c trace_store;
+  std::mutex init_lock;
+  std::atomic<int> next_config(0);
+
+  auto worker = [&]() {
+    int id;
+    while ((id = next_config++) < num_config) {
+      sweep_config_s& config = configs[id];
+      mkdir(config.m_out.c_str(), S_IRWXU);
+
+      // the first value of a knob wins: output directory, configuration, common
+      std::vector<std::string> args;
+      args.push_back(argv[0]);
+      args.push_back("--out=" + config.m_out);
+      args.insert(args.end(), config.m_args.begin(), config.m_args.end());
+      args.insert(args.end(), common_args.begin(), common_args.end());
+
+      std::vector<char*> sim_argv;
+      for (auto I = args.begin(), E = args.end(); I != E; ++I)
+        sim_argv.push_back(const_cast<char*>((*I).c_str()));
+      sim_argv.push_back(NULL);
+
+      macsim_c* sim = new macsim_c();
+      sim->m_trace_store = &trace_store;
+      sim->m_trace_store_user = id;
+      trace_store.add_user(id);
+
+      // initialization registers the (process-wide) factories
+      {
+        std::lock_guard<std::mutex> guard(init_lock);
+        sim->initialize(args.size(), sim_argv.data());
+      }
+
+      while (sim->run_a_cycle())
+        ;
+
+      sim->finalize();
+      trace_store.remove_user(id);
+
+      std::lock_guard<std::mutex> guard(init_lock);
+      std::cout << "sweep: " << config.m_out << " done ("
+                << sim->m_simulation_cycle << " cycles)\n";
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int ii = 1; ii < num_threads; ++ii) threads.push_back(std::thread(worker));
+  worker();
+  for (auto I = threads.begin(), E = threads.end(); I != E; ++I) (*I).join();
+
+  return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// trace_store_c constructor
+trace_store_c::trace_store_c() {
+}
+
+// trace_store_c destructor
+trace_store_c::~trace_store_c() {
+}
+
+// a simulator instance starts running
+void trace_store_c::add_user(int user) {
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_users.insert(user);
+}
+
+// a simulator instance is done
+void trace_store_c::remove_user(int user) {
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_users.erase(user);
+  for (auto I = m_entries.begin(), E = m_entries.end(); I != E; ++I) {
+    I->second->m_released.erase(user);
+    trim(I->second.get());
+  }
+}
+
+// get the inflated contents of a trace file
+trace_store_c::buffer_t trace_store_c::acquire(const std::string& filename,
+                                               int user, bool* loaded) {
+  entry_s* entry;
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    std::unique_ptr<entry_s>& slot = m_entries[filename];
+    if (!slot) slot.reset(new entry_s);
+    entry = slot.get();
+  }
+
+  // other files can be loaded in the meantime
+  std::lock_guard<std::mutex> guard(entry->m_lock);
+  buffer_t data;
+  {
+    std::lock_guard<std::mutex> store_guard(m_lock);
+    data = entry->m_weak.lock();
+  }
+
+  *loaded = false;
+  if (!data) {
+    data = load(filename);
+    if (!data) return NULL;
+    *loaded = true;
+  }
+
+  std::lock_guard<std::mutex> store_guard(m_lock);
+  entry->m_weak = data;
+  entry->m_data = data;
+  entry->m_released.erase(user);
+
+  return data;
+}
+
+// an instance is done with a trace file
+void trace_store_c::release(const std::string& filename, int user) {
+  std::lock_guard<std::mutex> guard(m_lock);
+  auto itr = m_entries.find(filename);
+  if (itr == m_entries.end()) return;
+
+  itr->second->m_released.insert(user);
+  trim(itr->second.get());
+}
+
+// keep the file only while a running instance may still read it
+void trace_store_c::trim(entry_s* entry) {
+  for (auto I = m_users.begin(), E = m_users.end(); I != E; ++I) {
+    if (entry->m_released.find(*I) == entry->m_released.end()) return;
+  }
+  entry->m_data.reset();
+}
+
+// inflate a whole trace file
+trace_store_c::buffer_t trace_store_c::load(const std::string& filename) {
+  std::shared_ptr<std::vector<char>> data(new std::vector<char>);
+  size_t size = 0;
+  int result;
+
+  if (block_trace_reader_c::is_block_trace(filename)) {
+    block_trace_reader_c reader;
+    if (!reader.open(filename)) return NULL;
+    do {
+      data->resize(size + SWEEP_READ_SIZE);
+      result = reader.read(data->data() + size, SWEEP_READ_SIZE);
+      if (result > 0) size += result;
+    } while (result > 0);
+    reader.close();
+  } else {
+    gzFile file = gzopen(filename.c_str(), "r");
+    if (file == NULL) return NULL;
+    do {
+      data->resize(size + SWEEP_READ_SIZE);
+      result = gzread(file, data->data() + size, SWEEP_READ_SIZE);
+      if (result > 0) size += result;
+    } while (result > 0);
+    gzclose(file);
+  }
+
+  if (result < 0) return NULL;
+
+  data->resize(size);
+  data->shrink_to_fit();
+  return data;
+}
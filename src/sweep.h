@@ -0,0 +1,145 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : sweep.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Parameter sweep (many configurations from one trace pass)
+ *********************************************************************************************/
+
+#ifndef SWEEP_H_INCLUDED
+#define SWEEP_H_INCLUDED
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "global_defs.h"
+#include "global_types.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// Sweep mode
+///
+/// macsim --sweep=<file> [--sweep_threads=<n>] [--knob=value ...]
+///
+/// Every non-empty line of the sweep file (except # comments) is one configuration:
+///   <output directory> [--knob=value ...]
+/// All configurations are simulated by one process, n at a time (one host thread each).
+/// Knob values of a line override the common values given on the command line, which in
+/// turn override params.in. Statistics and params.out of each configuration go to its
+/// output directory.
+///
+/// The configurations share the inflated trace bytes through trace_store_c: each trace
+/// file is decompressed once and served from memory to every instance. Decoding stays
+/// per instance because each configuration fetches with its own timing.
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Check whether the command line requests a sweep (--sweep=<file>)
+ */
+bool sweep_requested(int argc, char** argv);
+
+/**
+ * Run all configurations of a sweep. Returns the process exit code
+ */
+int run_sweep(int argc, char** argv);
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Inflated trace files shared by the simulator instances of a sweep
+///
+/// A file is loaded on its first acquire() and the store keeps it in memory while a running
+/// instance has not released it yet. Once every running instance has released it, the store
+/// only holds a weak reference: readers that still hold the buffer keep it alive, and a file
+/// that is acquired again after it has been dropped is simply reloaded.
+///////////////////////////////////////////////////////////////////////////////////////////////
+class trace_store_c
+{
+public:
+  typedef std::shared_ptr<const std::vector<char>> buffer_t;
+
+  /**
+   * Constructor
+   */
+  trace_store_c();
+
+  /**
+   * Destructor
+   */
+  ~trace_store_c();
+
+  /**
+   * A simulator instance starts running
+   */
+  void add_user(int user);
+
+  /**
+   * A simulator instance is done: drop the files only it was still holding
+   */
+  void remove_user(int user);
+
+  /**
+   * Get the inflated contents of a trace file (NULL if it cannot be read)
+   * @param user simulator instance
+   * @param loaded set to true if this call had to inflate the file
+   */
+  buffer_t acquire(const std::string& filename, int user, bool* loaded);
+
+  /**
+   * An instance is done with a trace file
+   */
+  void release(const std::string& filename, int user);
+
+private:
+  typedef struct entry_s {
+    std::mutex m_lock; /**< serializes loading of this file */
+    buffer_t m_data; /**< held while a running instance has not released the file */
+    std::weak_ptr<const std::vector<char>> m_weak; /**< inflated file, if still alive */
+    std::set<int> m_released; /**< instances that have released the file */
+  } entry_s;
+
+  /**
+   * Drop the store's reference once every running instance has released the file.
+   * Called with m_lock held
+   */
+  void trim(entry_s* entry);
+
+  /**
+   * Inflate a whole trace file (gzip or block trace)
+   */
+  static buffer_t load(const std::string& filename);
+
+  std::set<int> m_users; /**< running instances */
+  std::mutex m_lock; /**< protects m_entries, m_users and the reference state of entries */
+  std::unordered_map<std::string, std::unique_ptr<entry_s>> m_entries; /**< files */
+};
+
+#endif  // SWEEP_H_INCLUDED
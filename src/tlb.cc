@@ -34,6 +34,7 @@ POSSIBILITY OF SUCH DAMAGE.
  *********************************************************************************************/
 
 #include "tlb.h"
+#include "checkpoint.h"
 #include "debug_macros.h"
 #include "assert_macros.h"
 #include "all_knobs.h"
@@ -141,4 +142,25 @@ void TLB::invalidate(Addr page_number) {
     DEBUG("page:%llx invalidated - free_entries:%zu\n", page_number,
           m_free_entries.size());
   }
-}
\ No newline at end of file
+}
+
+void TLB::save_checkpoint(checkpoint_c *ckpt) {
+  ckpt->write<uint64_t>(m_table.size());
+  for (Entry *node = m_head->next; node != m_tail; node = node->next) {
+    ckpt->write(node->page_number);
+    ckpt->write(node->page_desc.frame_number);
+  }
+}
+
+void TLB::restore_checkpoint(checkpoint_c *ckpt) {
+  vector<pair<Addr, Addr>> entries(ckpt->read<uint64_t>());
+  for (auto &entry : entries) {
+    entry.first = ckpt->read<Addr>();
+    entry.second = ckpt->read<Addr>();
+  }
+
+  // insert from the LRU position so that the MRU entry ends up at the head. A smaller TLB
+  // keeps the most recently used entries
+  for (auto I = entries.rbegin(), E = entries.rend(); I != E; ++I)
+    insert(I->first << m_offset_bits, I->second);
+}
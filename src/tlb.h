@@ -70,6 +70,10 @@ public:
   void insert(Addr addr, Addr frame_number);
   void invalidate(Addr page_number);
 
+  // entries from MRU to LRU position
+  void save_checkpoint(checkpoint_c *ckpt);
+  void restore_checkpoint(checkpoint_c *ckpt);
+
 private:
   void detach(Entry *node) {
     node->prev->next = node->next;
@@ -0,0 +1,410 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : trace_file.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Trace file stream with optional background read-ahead (decompression)
+ *********************************************************************************************/
+
+#include <chrono>
+#include <cstring>
+
+#include "trace_file.h"
+#include "block_trace.h"
+#include "assert_macros.h"
+#include "macsim.h"
+#include "sweep.h"
+
+#include "all_stats.h"
+#include "statistics.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// trace_file_c constructor
+trace_file_c::trace_file_c(macsim_c* simBase) {
+  m_simBase = simBase;
+  m_file = NULL;
+  m_block = NULL;
+  m_is_block = false;
+  m_opened = false;
+  m_prefetcher = NULL;
+  m_depth = 0;
+  m_position = 0;
+  m_pending = 0;
+  m_eof = false;
+  m_current = NULL;
+  m_current_offset = 0;
+}
+
+// trace_file_c destructor
+trace_file_c::~trace_file_c() {
+  close();
+  delete m_block;
+
+  for (auto I = m_chunks.begin(), E = m_chunks.end(); I != E; ++I) {
+    delete[] (*I).m_data;
+  }
+}
+
+// open a trace file
+bool trace_file_c::open(const std::string& filename) {
+  // sweep mode: the file is inflated once for all simulator instances
+  if (m_simBase->m_trace_store) {
+    bool loaded;
+    m_shared = m_simBase->m_trace_store->acquire(
+      filename, m_simBase->m_trace_store_user, &loaded);
+    if (!m_shared) return false;
+
+    if (loaded)
+      STAT_EVENT(TRACE_STORE_LOAD);
+    else
+      STAT_EVENT(TRACE_STORE_SHARED);
+
+    m_filename = filename;
+    m_opened = true;
+    m_position = 0;
+    return true;
+  }
+
+  // block traces are detected by their header; everything else goes through zlib
+  m_is_block = block_trace_reader_c::is_block_trace(filename);
+  if (m_is_block) {
+    if (m_block == NULL) m_block = new block_trace_reader_c;
+    if (!m_block->open(filename)) return false;
+  } else {
+    m_file = gzopen(filename.c_str(), "r");
+    if (m_file == NULL) return false;
+  }
+  m_opened = true;
+
+  m_position = 0;
+  m_prefetcher = m_simBase->m_trace_prefetcher;
+  if (m_prefetcher == NULL) return true;
+
+  // chunks are allocated once; thread_s entries are recycled through a pool
+  if (m_chunks.empty()) {
+    m_depth = m_prefetcher->get_depth();
+    m_chunks.resize(m_depth);
+    for (int ii = 0; ii < m_depth; ++ii) {
+      m_chunks[ii].m_data = new char[m_prefetcher->get_chunk_size()];
+      m_chunks[ii].m_size = 0;
+      m_free.push_back(&m_chunks[ii]);
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_eof = false;
+  request_fill();
+
+  return true;
+}
+
+// close the trace file
+void trace_file_c::close(void) {
+  if (!m_opened) return;
+
+  if (m_shared) {
+    m_shared.reset();
+    m_simBase->m_trace_store->release(m_filename,
+                                     m_simBase->m_trace_store_user);
+    m_opened = false;
+    return;
+  }
+
+  if (m_prefetcher) quiesce();
+
+  if (m_is_block) {
+    m_block->close();
+  } else {
+    gzclose(m_file);
+    m_file = NULL;
+  }
+  m_opened = false;
+}
+
+// read len bytes from the current position
+int trace_file_c::read(void* buf, unsigned len) {
+  if (m_shared) {
+    off_t size = m_shared->size() - m_position;
+    if (size <= 0) return 0;
+    if (size > len) size = len;
+    memcpy(buf, m_shared->data() + m_position, size);
+    m_position += size;
+    return size;
+  }
+
+  if (m_prefetcher == NULL) return read_file(buf, len);
+
+  char* dst = static_cast<char*>(buf);
+  unsigned copied = 0;
+  while (copied < len) {
+    if (m_current && m_current->m_size < 0) return -1;
+
+    if (m_current == NULL || m_current_offset == m_current->m_size) {
+      // a short chunk is the last one in the file
+      if (m_current && m_current->m_size < m_prefetcher->get_chunk_size()) break;
+      if (next_chunk() == NULL) break;
+      continue;
+    }
+
+    unsigned size = m_current->m_size - m_current_offset;
+    if (size > len - copied) size = len - copied;
+    memcpy(dst + copied, m_current->m_data + m_current_offset, size);
+    m_current_offset += size;
+    copied += size;
+  }
+
+  m_position += copied;
+  return copied;
+}
+
+// move the read position relative to the current position
+off_t trace_file_c::seek_cur(off_t offset) {
+  if (m_shared) {
+    off_t position = m_position + offset;
+    if (position < 0) return -1;
+    // like gzseek, the position may be past the end of the file
+    m_position = position;
+    return m_position;
+  }
+
+  if (m_prefetcher == NULL) return seek_file(offset, SEEK_CUR);
+
+  // common case (ungetch) : the target is still in the current chunk
+  if (m_current && m_current->m_size >= 0 && m_current_offset + offset >= 0 &&
+      m_current_offset + offset <= m_current->m_size) {
+    m_current_offset += offset;
+    m_position += offset;
+    return m_position;
+  }
+
+  quiesce();
+  off_t result = seek_file(m_position + offset, SEEK_SET);
+  if (result >= 0) m_position = result;
+
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_eof = false;
+  request_fill();
+
+  return result;
+}
+
+// rewind to the beginning of the file
+void trace_file_c::rewind(void) {
+  if (m_shared) {
+    m_position = 0;
+    return;
+  }
+
+  if (m_prefetcher == NULL) {
+    seek_file(0, SEEK_SET);
+    return;
+  }
+
+  quiesce();
+  seek_file(0, SEEK_SET);
+  m_position = 0;
+
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_eof = false;
+  request_fill();
+}
+
+// last zlib error message
+const char* trace_file_c::error(void) {
+  if (m_shared) return "";
+  if (m_is_block) return m_block->error();
+
+  int errnum;
+  return gzerror(m_file, &errnum);
+}
+
+// read from the underlying file
+int trace_file_c::read_file(void* buf, unsigned len) {
+  if (m_is_block) return m_block->read(buf, len);
+
+  return gzread(m_file, buf, len);
+}
+
+// reposition the underlying file. For gzip traces a backward seek re-inflates the stream
+// from the beginning; block traces only inflate the target block
+off_t trace_file_c::seek_file(off_t offset, int whence) {
+  if (m_is_block) return m_block->seek(offset, whence);
+
+  return gzseek(m_file, offset, whence);
+}
+
+// keep one fill request in flight for every free chunk
+void trace_file_c::request_fill(void) {
+  while (!m_eof && m_pending < static_cast<int>(m_free.size())) {
+    ++m_pending;
+    m_prefetcher->submit(this);
+  }
+}
+
+// inflate the next chunk of the file
+void trace_file_c::fill(void) {
+  // fills of the same stream must be done in file order
+  std::lock_guard<std::mutex> read_guard(m_read_lock);
+
+  trace_chunk_s* chunk = NULL;
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (m_eof || m_free.empty()) {
+      --m_pending;
+      m_cv.notify_all();
+      return;
+    }
+    chunk = m_free.front();
+    m_free.pop_front();
+  }
+
+  int chunk_size = m_prefetcher->get_chunk_size();
+  int size = read_file(chunk->m_data, chunk_size);
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    chunk->m_size = size;
+    m_ready.push_back(chunk);
+    if (size < chunk_size) m_eof = true;
+    --m_pending;
+  }
+  m_cv.notify_all();
+}
+
+// wait for in-flight fills and drop all prefetched data
+void trace_file_c::quiesce(void) {
+  std::unique_lock<std::mutex> guard(m_lock);
+  m_cv.wait(guard, [this] { return m_pending == 0; });
+
+  if (m_current) {
+    m_free.push_back(m_current);
+    m_current = NULL;
+  }
+  while (!m_ready.empty()) {
+    m_free.push_back(m_ready.front());
+    m_ready.pop_front();
+  }
+  m_current_offset = 0;
+}
+
+// recycle the drained chunk and get the next one
+trace_chunk_s* trace_file_c::next_chunk(void) {
+  std::unique_lock<std::mutex> guard(m_lock);
+
+  if (m_current) {
+    m_free.push_back(m_current);
+    m_current = NULL;
+    request_fill();
+  }
+
+  if (m_ready.empty()) {
+    if (m_eof && m_pending == 0) return NULL;
+
+    // decompression has not caught up with the simulation
+    STAT_EVENT(TRACE_PREFETCH_STALL);
+    if (m_prefetcher->m_last_stall_cycle != m_simBase->m_simulation_cycle) {
+      m_prefetcher->m_last_stall_cycle = m_simBase->m_simulation_cycle;
+      STAT_EVENT(TRACE_PREFETCH_STALL_CYCLE);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    m_cv.wait(guard, [this] { return !m_ready.empty() || (m_eof && m_pending == 0); });
+    auto wait_time = std::chrono::steady_clock::now() - start;
+    STAT_EVENT_N(TRACE_PREFETCH_STALL_USEC,
+                 std::chrono::duration_cast<std::chrono::microseconds>(wait_time).count());
+
+    if (m_ready.empty()) return NULL;
+  } else {
+    STAT_EVENT(TRACE_PREFETCH_HIT);
+  }
+
+  m_current = m_ready.front();
+  m_ready.pop_front();
+  m_current_offset = 0;
+
+  return m_current;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// trace_prefetcher_c constructor
+trace_prefetcher_c::trace_prefetcher_c(int num_threads, int depth, int chunk_size) {
+  m_depth = depth;
+  m_chunk_size = chunk_size;
+  m_exit = false;
+  m_last_stall_cycle = 0;
+
+  if (num_threads < 1) num_threads = 1;
+  for (int ii = 0; ii < num_threads; ++ii) {
+    m_workers.push_back(std::thread(&trace_prefetcher_c::worker_loop, this));
+  }
+}
+
+// trace_prefetcher_c destructor
+trace_prefetcher_c::~trace_prefetcher_c() {
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_exit = true;
+  }
+  m_cv.notify_all();
+
+  for (auto I = m_workers.begin(), E = m_workers.end(); I != E; ++I) {
+    (*I).join();
+  }
+}
+
+// queue one chunk fill
+void trace_prefetcher_c::submit(trace_file_c* file) {
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_queue.push_back(file);
+  }
+  m_cv.notify_one();
+}
+
+// decompression thread
+void trace_prefetcher_c::worker_loop(void) {
+  while (true) {
+    trace_file_c* file;
+    {
+      std::unique_lock<std::mutex> guard(m_lock);
+      m_cv.wait(guard, [this] { return m_exit || !m_queue.empty(); });
+      // drain outstanding fills so that no stream waits forever
+      if (m_queue.empty()) return;
+
+      file = m_queue.front();
+      m_queue.pop_front();
+    }
+
+    file->fill();
+  }
+}
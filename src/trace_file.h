@@ -0,0 +1,229 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**********************************************************************************************
+ * File         : trace_file.h
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Trace file stream with optional background read-ahead (decompression)
+ *********************************************************************************************/
+
+#ifndef TRACE_FILE_H_INCLUDED
+#define TRACE_FILE_H_INCLUDED
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+#include "global_defs.h"
+#include "global_types.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Decompressed trace chunk
+///////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct trace_chunk_s {
+  char* m_data; /**< decompressed bytes */
+  int m_size; /**< valid bytes (-1 on read error) */
+} trace_chunk_s;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Per-thread trace file stream
+///
+/// Wraps a gzip trace file or a seekable block trace (see block_trace.h); the format is
+/// detected when the file is opened. Without a prefetcher, every call maps directly onto the
+/// underlying file. With a prefetcher, up to m_depth chunks of the file are
+/// inflated ahead of the simulator by a background thread; read() consumes them and
+/// recycles each chunk as soon as it has been drained, so memory per stream is bounded by
+/// depth * chunk size. Seeking quiesces the prefetcher for this stream, repositions the
+/// underlying file at the logical (consumer) position and restarts read-ahead.
+///
+/// In sweep mode (see sweep.h) the whole inflated file comes from the trace store shared
+/// by all simulator instances, and the stream reads it from memory (no prefetcher).
+///////////////////////////////////////////////////////////////////////////////////////////////
+class trace_file_c
+{
+  friend class trace_prefetcher_c;
+
+public:
+  /**
+   * Constructor
+   */
+  trace_file_c(macsim_c* simBase);
+
+  /**
+   * Destructor
+   */
+  ~trace_file_c();
+
+  /**
+   * Open a trace file. Returns false if the file cannot be opened
+   */
+  bool open(const std::string& filename);
+
+  /**
+   * Close the trace file
+   */
+  void close(void);
+
+  /**
+   * Read len bytes (gzread semantics: bytes read, 0 at the end of file, -1 on error)
+   */
+  int read(void* buf, unsigned len);
+
+  /**
+   * Move the read position by offset bytes from the current position (gzseek SEEK_CUR)
+   * @return new position, -1 on error
+   */
+  off_t seek_cur(off_t offset);
+
+  /**
+   * Rewind to the beginning of the file
+   */
+  void rewind(void);
+
+  /**
+   * Return the last zlib error message
+   */
+  const char* error(void);
+
+private:
+  trace_file_c();  // do not implement
+
+  /**
+   * Issue read-ahead requests until all chunks are in flight (m_lock held)
+   */
+  void request_fill(void);
+
+  /**
+   * Inflate one chunk (called by a prefetcher thread)
+   */
+  void fill(void);
+
+  /**
+   * Wait until no read-ahead is in flight and drop all prefetched chunks
+   */
+  void quiesce(void);
+
+  /**
+   * Get the next prefetched chunk, waiting for the prefetcher if necessary
+   */
+  trace_chunk_s* next_chunk(void);
+
+  /**
+   * Read from the underlying file
+   */
+  int read_file(void* buf, unsigned len);
+
+  /**
+   * Reposition the underlying file (SEEK_SET or SEEK_CUR)
+   */
+  off_t seek_file(off_t offset, int whence);
+
+  gzFile m_file; /**< gzip trace file */
+  block_trace_reader_c* m_block; /**< block trace reader */
+  bool m_is_block; /**< current file is a block trace */
+  bool m_opened; /**< file opened */
+  trace_prefetcher_c* m_prefetcher; /**< read-ahead engine (NULL: synchronous) */
+  int m_depth; /**< number of chunks per stream */
+  off_t m_position; /**< logical read position (bytes delivered) */
+  std::shared_ptr<const std::vector<char>> m_shared; /**< file from the trace store */
+  std::string m_filename; /**< file name (trace store key) */
+
+  std::mutex m_read_lock; /**< serializes inflation of this stream */
+  std::mutex m_lock; /**< protects the prefetch state below */
+  std::condition_variable m_cv; /**< signals chunk completion */
+  std::vector<trace_chunk_s> m_chunks; /**< chunk storage */
+  std::list<trace_chunk_s*> m_free; /**< chunks available for read-ahead */
+  std::deque<trace_chunk_s*> m_ready; /**< inflated chunks in file order */
+  int m_pending; /**< chunks queued or being inflated */
+  bool m_eof; /**< read-ahead reached the end of file */
+  trace_chunk_s* m_current; /**< chunk being consumed */
+  int m_current_offset; /**< consumed bytes in m_current */
+
+  macsim_c* m_simBase; /**< macsim_c base class for simulation globals */
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Background trace decompression engine shared by all trace streams
+///////////////////////////////////////////////////////////////////////////////////////////////
+class trace_prefetcher_c
+{
+public:
+  /**
+   * Constructor
+   * @param num_threads number of decompression threads
+   * @param depth number of chunks read ahead per stream
+   * @param chunk_size chunk size in bytes
+   */
+  trace_prefetcher_c(int num_threads, int depth, int chunk_size);
+
+  /**
+   * Destructor
+   */
+  ~trace_prefetcher_c();
+
+  /**
+   * Queue one chunk fill for a stream
+   */
+  void submit(trace_file_c* file);
+
+  int get_depth(void) {
+    return m_depth;
+  }
+
+  int get_chunk_size(void) {
+    return m_chunk_size;
+  }
+
+  Counter m_last_stall_cycle; /**< last simulation cycle that stalled on a trace read */
+
+private:
+  trace_prefetcher_c();  // do not implement
+
+  /**
+   * Decompression thread main loop
+   */
+  void worker_loop(void);
+
+  int m_depth; /**< chunks per stream */
+  int m_chunk_size; /**< chunk size in bytes */
+  std::vector<std::thread> m_workers; /**< decompression threads */
+  std::mutex m_lock; /**< protects the request queue */
+  std::condition_variable m_cv; /**< signals new requests */
+  std::deque<trace_file_c*> m_queue; /**< fill requests */
+  bool m_exit; /**< terminate threads */
+};
+
+#endif  // TRACE_FILE_H_INCLUDED
@@ -44,6 +44,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "core.h"
 #include "knob.h"
 #include "process_manager.h"
+#include "trace_file.h"
+#include "checkpoint.h"
+#include "retire.h"
 #include "debug_macros.h"
 // #include "statistics.h"
 #include "frontend.h"
@@ -54,6 +57,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "sw_managed_cache.h"
 #include "memory.h"
 #include "inst_info.h"
+#include "host_profile.h"
 
 #include "trace_read_cpu.h"
 #include "trace_read_a64.h"
@@ -196,10 +200,13 @@ void trace_read_c::setup_trace(int core_id, int sim_thread_id) {
   // will be read ahead to get next pc address
   if (core->m_running_thread_num) {
 #ifndef USING_QSIM
-    if ((size = gzread(thread_trace_info->m_trace_file,
-                       thread_trace_info->m_prev_trace_info, m_trace_size)) <=
-        0)
-      printf("%s\n", gzerror(thread_trace_info->m_trace_file, 0));
+    // a thread restored from a checkpoint resumes after its last retired instruction
+    Counter skip = m_simBase->m_checkpoint->get_trace_skip(thread_trace_info);
+    if (skip > 0) restore_trace(core_id, sim_thread_id, skip);
+
+    if ((size = thread_trace_info->m_trace_file->read(
+           thread_trace_info->m_prev_trace_info, m_trace_size)) <= 0)
+      printf("%s\n", thread_trace_info->m_trace_file->error());
 #else
     m_tg->read_trace(core_id, (void *)(thread_trace_info->m_prev_trace_info),
                      m_trace_size);
@@ -211,6 +218,40 @@ void trace_read_c::setup_trace(int core_id, int sim_thread_id) {
   }
 }
 
+// skip the instructions a thread retired before the checkpoint was taken
+void trace_read_c::restore_trace(int core_id, int sim_thread_id, Counter skip) {
+  core_c *core = m_simBase->m_core_pointers[core_id];
+  thread_s *thread_trace_info = core->get_trace_info(sim_thread_id);
+
+  if (thread_trace_info->m_trace_file->seek_cur(skip * m_trace_size) < 0)
+    ASSERTM(0, "core_id:%d thread_id:%d cannot skip %llu instructions\n",
+            core_id, sim_thread_id, skip);
+
+  core->m_inst_fetched[sim_thread_id] += skip;
+  core->get_retire()->set_instrs_retired(sim_thread_id, skip);
+
+  // the main thread spawns the threads that started before the restored position
+  if (thread_trace_info->m_main_thread) {
+    process_s *process = thread_trace_info->m_process;
+    thread_trace_info->m_inst_count = skip;
+
+    while (process->m_no_of_threads_created < process->m_no_of_threads &&
+           process->m_thread_start_info[process->m_no_of_threads_created]
+               .m_inst_count <= skip) {
+      m_simBase->m_process_manager->create_thread_node(
+        process, process->m_no_of_threads_created++, false);
+      m_simBase->m_process_manager->sim_thread_schedule(false);
+    }
+  }
+}
+
+// functional fast-forward is implemented by the x86 decoder only
+Counter trace_read_c::fast_forward(int core_id, int sim_thread_id,
+                                   Counter num_insts) {
+  ASSERTM(0, "sampled simulation is not supported by this trace type\n");
+  return 0;
+}
+
 /**
  * @param core_id - core id
  * @param trace_info - trace information
@@ -237,8 +278,8 @@ bool trace_read_c::read_trace(int core_id, void *trace_info, int sim_thread_id,
       if (thread_trace_info->m_buffer_index == 0) {
 #ifndef USING_QSIM
         thread_trace_info->m_buffer_index_max =
-          gzread(thread_trace_info->m_trace_file, thread_trace_info->m_buffer,
-                 m_trace_size * k_trace_buffer_size);
+          thread_trace_info->m_trace_file->read(thread_trace_info->m_buffer,
+                                                m_trace_size * k_trace_buffer_size);
 #else
         int uops_read = m_tg->read_trace(core_id, thread_trace_info->m_buffer,
                                          m_trace_size * k_trace_buffer_size);
@@ -728,6 +769,8 @@ void trace_reader_wrapper_c::setup_trace(int core_id, int sim_thread_id,
 bool trace_reader_wrapper_c::get_uops_from_traces(int core_id, uop_c *uop,
                                                   int sim_thread_id,
                                                   bool gpu_sim) {
+  HOST_PROF_SCOPE(HOST_PROF_TRACE);
+
   if (gpu_sim)
     return m_gpu_decoder->get_uops_from_traces(core_id, uop, sim_thread_id);
   else
@@ -737,3 +780,8 @@ bool trace_reader_wrapper_c::get_uops_from_traces(int core_id, uop_c *uop,
 void trace_reader_wrapper_c::pre_read_trace(thread_s *trace_info) {
   m_gpu_decoder->pre_read_trace(trace_info);
 }
+
+Counter trace_reader_wrapper_c::fast_forward(int core_id, int sim_thread_id,
+                                             Counter num_insts) {
+  return m_cpu_decoder->fast_forward(core_id, sim_thread_id, num_insts);
+}
@@ -948,6 +948,27 @@ public:
    */
   void setup_trace(int core_id, int sim_thread_id);
 
+  /**
+   * Move a thread restored from a checkpoint past the instructions it had retired
+   * @param core_id - core id
+   * @param sim_thread_id - thread id
+   * @param skip - number of trace records to skip
+   * @see checkpoint_c::get_trace_skip
+   */
+  void restore_trace(int core_id, int sim_thread_id, Counter skip);
+
+  /**
+   * Sampled simulation : skip instructions functionally. Skipped instructions warm the
+   * caches and branch predictors but do not go through the pipeline
+   * @param core_id - core id
+   * @param sim_thread_id - thread id
+   * @param num_insts - number of instructions to skip
+   * @return number of skipped instructions (less at the end of the trace)
+   * @see sampler_c::fetch_ready
+   */
+  virtual Counter fast_forward(int core_id, int sim_thread_id,
+                               Counter num_insts);
+
   /**
    * Initialize the mapping between trace opcode and uop type
    */
@@ -1066,6 +1087,7 @@ public:
   bool get_uops_from_traces(int core_id, uop_c *uop, int sim_thread_id,
                             bool gpu_sim);
   void pre_read_trace(thread_s *trace_info);
+  Counter fast_forward(int core_id, int sim_thread_id, Counter num_insts);
 
 private:
   trace_reader_wrapper_c();
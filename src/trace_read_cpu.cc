@@ -55,6 +55,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "sw_managed_cache.h"
 #include "memory.h"
 #include "inst_info.h"
+#include "inst_info_cache.h"
 #include "page_mapping.h"
 
 #include "all_knobs.h"
@@ -318,7 +319,7 @@ inst_info_s *cpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
   // simulator maintains a cache of decoded instructions (uop) for each process,
   // this avoids decoding of instructions everytime an instruction is executed
   int process_id = core->get_trace_info(sim_thread_id)->m_process->m_process_id;
-  hash_c<inst_info_s> *htable = m_simBase->m_inst_info_hash[process_id];
+  inst_info_cache_c *inst_cache = m_simBase->m_inst_info_hash[process_id];
 
   // since each instruction can be decoded into multiple uops, the key to the
   // hashtable has to be (instruction addr + something else)
@@ -329,7 +330,9 @@ inst_info_s *cpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
 
   // Get instruction information from the hash table if exists.
   // Else create a new entry
-  inst_info_s *info = htable->hash_table_access_create(key_addr, &new_entry);
+  inst_info_s *info = inst_cache->access_create(
+    key_addr, &new_entry,
+    core->get_trace_info(sim_thread_id)->m_unique_thread_id);
 
   inst_info_s *first_info = info;
   int num_uop = 0;
@@ -634,7 +637,7 @@ inst_info_s *cpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
       // we need to create hash entries
       if (ii > 0) {
         key_addr = ((pi->m_instruction_addr << 3) + ii);
-        info = htable->hash_table_access_create(key_addr, &new_entry);
+        info = inst_cache->access_create(key_addr, &new_entry);
         info->m_trace_info.m_bom = false;
         info->m_trace_info.m_eom = false;
       }
@@ -745,7 +748,7 @@ inst_info_s *cpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
     for (ii = 0; ii < num_uop; ++ii) {
       if (ii > 0) {
         key_addr = ((pi->m_instruction_addr << 3) + ii);
-        info = htable->hash_table_access_create(key_addr, &new_entry);
+        info = inst_cache->access_create(key_addr, &new_entry);
       }
       ASSERTM(!new_entry, "Core id %d index %d\n", core_id, ii);
 
@@ -782,7 +785,7 @@ inst_info_s *cpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
 
     // generate multiple uops with different memory addresses
     key_addr = ((pi->m_instruction_addr << 3));
-    info = htable->hash_table_access_create(key_addr, &new_entry);
+    info = inst_cache->access_create(key_addr, &new_entry);
 
     int rep_mem_size = (int)pi->m_mem_read_size;
 
@@ -825,7 +828,7 @@ inst_info_s *cpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
         for (ii = 0; ii < num_uop; ++ii) {
           // can't skip when ii = 0; because this routine is repeating ...
           key_addr = ((pi->m_instruction_addr << 3) + ii);
-          info = htable->hash_table_access_create(key_addr, &new_entry);
+          info = inst_cache->access_create(key_addr, &new_entry);
 
           info->m_trace_info.m_bom = false;
           info->m_trace_info.m_eom = false;
@@ -947,6 +950,74 @@ inst_info_s *cpu_decoder_c::get_inst_info(thread_s *thread_trace_info,
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
+// the thread must be at an instruction boundary. each skipped record goes through the same
+// one-ahead read as get_uops_from_traces(), so spawned threads are still created and the
+// next detailed fetch starts with the following instruction. the last record of the trace
+// is left for the detailed path, which ends the thread
+Counter cpu_decoder_c::fast_forward(int core_id, int sim_thread_id,
+                                    Counter num_insts) {
+  core_c *core = m_simBase->m_core_pointers[core_id];
+  thread_s *thread_trace_info = core->get_trace_info(sim_thread_id);
+  frontend_c *frontend = core->get_frontend();
+  int appl_id = core->get_appl_id(sim_thread_id);
+  int line_size = m_simBase->m_memory->line_size(core_id);
+  Addr addr_base = m_simBase->m_memory->base_addr(
+    core_id,
+    (unsigned long)UINT_MAX * (thread_trace_info->m_process->m_process_id) *
+      10ul);
+
+  ASSERT(thread_trace_info->m_bom);
+
+  Counter skipped = 0;
+  while (skipped < num_insts && !core->m_fetch_ended[sim_thread_id] &&
+         core->m_inst_fetched[sim_thread_id] < *KNOB(KNOB_MAX_INSTS)) {
+    bool inst_read = false;
+    if (!read_trace(core_id, thread_trace_info->m_next_trace_info,
+                    sim_thread_id, &inst_read) ||
+        !inst_read)
+      break;
+
+    trace_info_cpu_s *pi =
+      static_cast<trace_info_cpu_s *>(thread_trace_info->m_prev_trace_info);
+
+    // instruction cache and branch predictors
+    int cf_type = NOT_CF;
+    if (pi->m_cf_type)
+      cf_type = (pi->m_cf_type >= PIN_CF_SYS) ? CF_ICO : pi->m_cf_type;
+    frontend->warm_inst(sim_thread_id, pi->m_instruction_addr, cf_type,
+                        pi->m_actually_taken, pi->m_branch_target);
+
+    // data caches : every line touched by the loads and the store
+    int amp_val =
+      (pi->m_opcode == XED_CATEGORY_STRINGOP) ? *KNOB(KNOB_MEM_SIZE_AMP) : 1;
+    for (int ii = 0; ii < pi->m_num_ld + (pi->m_has_st ? 1 : 0); ++ii) {
+      bool store = (ii == pi->m_num_ld);
+      Addr va = store ? pi->m_st_vaddr
+                      : (ii == 0 ? pi->m_ld_vaddr1 : pi->m_ld_vaddr2);
+      uns size = (store ? pi->m_mem_write_size : pi->m_mem_read_size) * amp_val;
+      if (va == 0) continue;
+
+      Addr addr = MIN2(va * amp_val, MAX_ADDR) + addr_base;
+      Addr end = addr + MIN2(MAX2(size, 1u), (uns)REP_MOV_MEM_SIZE_MAX_NEW);
+      for (Addr line = addr & -line_size; line < end; line += line_size)
+        m_simBase->m_memory->warm_cache(core_id, sim_thread_id, appl_id, line,
+                                        store, MEM_L1);
+    }
+
+    memcpy(thread_trace_info->m_prev_trace_info,
+           thread_trace_info->m_next_trace_info, sizeof(trace_info_cpu_s));
+
+    ++core->m_inst_fetched[sim_thread_id];
+    if (core->m_inst_fetched[sim_thread_id] > core->m_max_inst_fetched)
+      core->m_max_inst_fetched = core->m_inst_fetched[sim_thread_id];
+    ++skipped;
+  }
+
+  return skipped;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
  * Get an uop from trace
  * Called by frontend.cc
@@ -85,6 +85,15 @@ public:
    */
   void pre_read_trace(thread_s *trace_info);
 
+  /**
+   * Sampled simulation : skip instructions functionally
+   * @param core_id - core id
+   * @param sim_thread_id - thread id
+   * @param num_insts - number of instructions to skip
+   * @return number of skipped instructions
+   */
+  Counter fast_forward(int core_id, int sim_thread_id, Counter num_insts);
+
   static const char *g_tr_reg_names[MAX_TR_REG]; /**< register name string */
   static const char
     *g_tr_opcode_names[MAX_TR_OPCODE_NAME]; /**< opcode name string */
@@ -5,6 +5,7 @@
 #include "assert_macros.h"
 #include "debug_macros.h"
 #include "utils.h"
+#include "inst_info_cache.h"
 #include "all_knobs.h"
 #include "statistics.h"
 #include "statsEnums.h"
@@ -491,7 +492,7 @@ inst_info_s *igpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
   // simulator maintains a cache of decoded instructions (uop) for each process,
   // this avoids decoding of instructions everytime an instruction is executed
   int process_id = core->get_trace_info(sim_thread_id)->m_process->m_process_id;
-  hash_c<inst_info_s> *htable = m_simBase->m_inst_info_hash[process_id];
+  inst_info_cache_c *inst_cache = m_simBase->m_inst_info_hash[process_id];
 
   // since each instruction can be decoded into multiple uops, the key to the
   // hashtable has to be (instruction addr + something else)
@@ -502,7 +503,9 @@ inst_info_s *igpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
 
   // Get instruction information from the hash table if exists.
   // Else create a new entry
-  inst_info_s *info = htable->hash_table_access_create(key_addr, &new_entry);
+  inst_info_s *info = inst_cache->access_create(
+    key_addr, &new_entry,
+    core->get_trace_info(sim_thread_id)->m_unique_thread_id);
 
   inst_info_s *first_info = info;
   int num_uop = 0;
@@ -741,7 +744,7 @@ inst_info_s *igpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
       // we need to create hash entries
       if (ii > 0) {
         key_addr = ((pi->m_instruction_addr << 3) + ii);
-        info = htable->hash_table_access_create(key_addr, &new_entry);
+        info = inst_cache->access_create(key_addr, &new_entry);
         info->m_trace_info.m_bom = false;
         info->m_trace_info.m_eom = false;
       }
@@ -836,7 +839,7 @@ inst_info_s *igpu_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
     for (ii = 0; ii < num_uop; ++ii) {
       if (ii > 0) {
         key_addr = ((pi->m_instruction_addr << 3) + ii);
-        info = htable->hash_table_access_create(key_addr, &new_entry);
+        info = inst_cache->access_create(key_addr, &new_entry);
       }
       ASSERTM(!new_entry, "Core id %d index %d\n", core_id, ii);
 
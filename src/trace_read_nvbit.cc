@@ -45,6 +45,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "core.h"
 #include "knob.h"
 #include "process_manager.h"
+#include "trace_file.h"
 #include "debug_macros.h"
 #include "statistics.h"
 #include "frontend.h"
@@ -55,6 +56,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "sw_managed_cache.h"
 #include "memory.h"
 #include "inst_info.h"
+#include "inst_info_cache.h"
 
 #include "all_knobs.h"
 
@@ -127,7 +129,7 @@ bool nvbit_decoder_c::peek_trace(int core_id, void *t_info, int sim_thread_id,
   }
   // read one instruction each
   else {
-    bytes_read = gzread(thread_trace_info->m_trace_file, trace_info, m_trace_size);
+    bytes_read = thread_trace_info->m_trace_file->read(trace_info, m_trace_size);
   }
 
   if (m_trace_size == bytes_read) {
@@ -167,8 +169,8 @@ bool nvbit_decoder_c::ungetch_trace(int core_id, int sim_thread_id,
     thread_trace_info->m_buffer_index = 0;
   }
 
-  off_t offset = gzseek(thread_trace_info->m_trace_file,
-                        -1 * num_inst * m_trace_size, SEEK_CUR);
+  off_t offset = thread_trace_info->m_trace_file->seek_cur(
+    -1 * num_inst * m_trace_size);
   if (offset == -1) {
     return false;
   }
@@ -315,13 +317,14 @@ void nvbit_decoder_c::pre_read_trace(thread_s *trace_info) {
   int bytes_read;
   trace_info_nvbit_s inst_info;
 
-  while ((bytes_read = gzread(trace_info->m_trace_file, &inst_info,
-                              m_trace_size)) == m_trace_size) {
+  while ((bytes_read = trace_info->m_trace_file->read(&inst_info,
+                                                      m_trace_size)) ==
+         m_trace_size) {
     // printing opcode..
     printf("%x ", inst_info.m_opcode);
   }
   printf("\n");
-  gzrewind(trace_info->m_trace_file);
+  trace_info->m_trace_file->rewind();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,7 +408,7 @@ inst_info_s *nvbit_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
   // simulator maintains a cache of decoded instructions (uop) for each process,
   // this avoids decoding of instructions everytime an instruction is executed
   int process_id = core->get_trace_info(sim_thread_id)->m_process->m_process_id;
-  hash_c<inst_info_s> *htable = m_simBase->m_inst_info_hash[process_id];
+  inst_info_cache_c *inst_cache = m_simBase->m_inst_info_hash[process_id];
 
   // since each instruction can be decoded into multiple uops, the key to the
   // hashtable has to be (instruction addr + something else)
@@ -416,7 +419,9 @@ inst_info_s *nvbit_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
 
   // Get instruction information from the hash table if exists.
   // Else create a new entry
-  inst_info_s *info = htable->hash_table_access_create(key_addr, &new_entry);
+  inst_info_s *info = inst_cache->access_create(
+    key_addr, &new_entry,
+    core->get_trace_info(sim_thread_id)->m_unique_thread_id);
 
   inst_info_s *first_info = info;
   int num_uop = 0;
@@ -612,7 +617,7 @@ inst_info_s *nvbit_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
       // we need to create hash entries
       if (ii > 0) {
         key_addr = ((pi->m_inst_addr << 3) + ii);
-        info = htable->hash_table_access_create(key_addr, &new_entry);
+        info = inst_cache->access_create(key_addr, &new_entry);
         info->m_trace_info.m_bom = false;
         info->m_trace_info.m_eom = false;
       }
@@ -722,7 +727,7 @@ inst_info_s *nvbit_decoder_c::convert_pinuop_to_t_uop(void *trace_info,
     for (ii = 0; ii < num_uop; ++ii) {
       if (ii > 0) {
         key_addr = ((pi->m_inst_addr << 3) + ii);
-        info = htable->hash_table_access_create(key_addr, &new_entry);
+        info = inst_cache->access_create(key_addr, &new_entry);
       }
       ASSERTM(!new_entry, "Core id %d index %d\n", core_id, ii);
 
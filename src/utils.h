@@ -54,6 +54,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "uop.h"
 #include "map.h"
 #include "bp.h"
+#include "pool.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -100,116 +101,6 @@ FILE* file_tag_fopen(std::string, char const* const, macsim_c*);
 
 using namespace std;
 
-///////////////////////////////////////////////////////////////////////////////////////////////
-/// \brief pool class
-///////////////////////////////////////////////////////////////////////////////////////////////
-template <class T>
-class pool_c
-{
-public:
-  /**
-   * Constructor
-   */
-  pool_c() {
-    m_pool = new list<T*>;
-    m_poolsize = 0;
-    m_poolexpand_unit = 1;
-    m_name = "none";
-  }
-
-  /**
-   * Constructor
-   * @param pool_expand_unit number of entries when pool expands
-   * @param name pool name
-   */
-  pool_c(int pool_expand_unit, string name) {
-    m_pool = new list<T*>;
-    m_poolsize = 0;
-    m_poolexpand_unit = pool_expand_unit;
-    m_name = name;
-  }
-
-  /**
-   * Destructor
-   */
-  ~pool_c() {
-    while (!m_pool->empty()) {
-      T* entry = m_pool->front();
-      m_pool->pop_front();
-      delete entry;
-    }
-    delete m_pool;
-  }
-
-  /**
-   * Acquire a new entry
-   */
-  T* acquire_entry(void) {
-    if (m_pool->empty()) {
-      expand_pool();
-    }
-    T* entry = m_pool->front();
-    m_pool->pop_front();
-    return entry;
-  }
-
-  /**
-   * Acquire a new entry
-   *   whose class requires simBase reference
-   */
-  T* acquire_entry(macsim_c* m_simBase) {
-    if (m_pool->empty()) {
-      expand_pool(m_simBase);
-    }
-    T* entry = m_pool->front();
-    m_pool->pop_front();
-    return entry;
-  }
-
-  /**
-   * Release a new entry
-   */
-  void release_entry(T* entry) {
-    m_pool->push_front(entry);
-  }
-
-  /**
-   * Expand the pool
-   */
-  void expand_pool(void) {
-    for (int ii = 0; ii < m_poolexpand_unit; ++ii) {
-      T* entries = new T;
-      m_pool->push_back(entries);
-    }
-    m_poolsize += m_poolexpand_unit;
-  }
-
-  /**
-   * Expand the pool
-   *  whose class requires simBase reference
-   */
-  void expand_pool(macsim_c* m_simBase) {
-    for (int ii = 0; ii < m_poolexpand_unit; ++ii) {
-      T* entries = new T(m_simBase);
-      m_pool->push_back(entries);
-    }
-    m_poolsize += m_poolexpand_unit;
-  }
-
-  /**
-   * Return the size of a pool
-   */
-  int size(void) {
-    return m_poolsize;
-  }
-
-private:
-  list<T*>* m_pool; /**< pool */
-  int m_poolsize; /**< pool size */
-  int m_poolexpand_unit; /**< pool expand unit */
-  string m_name; /**< pool name */
-};
-
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief hash table class
 ///////////////////////////////////////////////////////////////////////////////////////////////
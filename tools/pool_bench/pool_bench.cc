@@ -0,0 +1,155 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : pool_bench.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Acquire/release throughput of pool_c against the list based pool
+ *********************************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "pool.h"
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief previous pool implementation (one heap node per free entry)
+///////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+class list_pool_c
+{
+public:
+  list_pool_c(int pool_expand_unit, string name) {
+    m_pool = new list<T*>;
+    m_poolsize = 0;
+    m_poolexpand_unit = pool_expand_unit;
+    m_name = name;
+  }
+
+  ~list_pool_c() {
+    while (!m_pool->empty()) {
+      T* entry = m_pool->front();
+      m_pool->pop_front();
+      delete entry;
+    }
+    delete m_pool;
+  }
+
+  T* acquire_entry(macsim_c* m_simBase) {
+    if (m_pool->empty()) {
+      expand_pool(m_simBase);
+    }
+    T* entry = m_pool->front();
+    m_pool->pop_front();
+    return entry;
+  }
+
+  void release_entry(T* entry) {
+    m_pool->push_front(entry);
+  }
+
+  void expand_pool(macsim_c* m_simBase) {
+    for (int ii = 0; ii < m_poolexpand_unit; ++ii) {
+      T* entries = new T(m_simBase);
+      m_pool->push_back(entries);
+    }
+    m_poolsize += m_poolexpand_unit;
+  }
+
+private:
+  list<T*>* m_pool;
+  int m_poolsize;
+  int m_poolexpand_unit;
+  string m_name;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief entry with the footprint of a uop_c
+///////////////////////////////////////////////////////////////////////////////////////////////
+struct bench_entry_s {
+  bench_entry_s(macsim_c* simBase) : m_simBase(simBase), m_num(0) {
+  }
+
+  macsim_c* m_simBase;
+  long m_num;
+  char m_payload[1024];
+};
+
+// keep num_live entries in flight; release the oldest (fifo) or the youngest (lifo) one
+template <class POOL>
+static double run(POOL* pool, long num_ops, int num_live, bool fifo) {
+  vector<bench_entry_s*> live(num_live);
+  for (int ii = 0; ii < num_live; ++ii) live[ii] = pool->acquire_entry(NULL);
+
+  long sum = 0;
+  auto start = chrono::steady_clock::now();
+  for (long ii = 0; ii < num_ops; ++ii) {
+    int slot = fifo ? static_cast<int>(ii % num_live) : num_live - 1;
+    pool->release_entry(live[slot]);
+    bench_entry_s* entry = pool->acquire_entry(NULL);
+    entry->m_num = ii;
+    sum += entry->m_payload[ii & 1023];
+    live[slot] = entry;
+  }
+  auto end = chrono::steady_clock::now();
+
+  for (int ii = 0; ii < num_live; ++ii) pool->release_entry(live[ii]);
+  if (sum == 1) printf(" ");
+
+  return chrono::duration<double, nano>(end - start).count() / num_ops;
+}
+
+int main(int argc, char** argv) {
+  long num_ops = argc > 1 ? atol(argv[1]) : 50000000;
+  int num_live = argc > 2 ? atoi(argv[2]) : 512;
+
+  for (int fifo = 1; fifo >= 0; --fifo) {
+    list_pool_c<bench_entry_s>* list_pool =
+      new list_pool_c<bench_entry_s>(1000, "list");
+    pool_c<bench_entry_s>* slab_pool = new pool_c<bench_entry_s>(1000, "slab");
+
+    double list_ns = run(list_pool, num_ops, num_live, fifo);
+    double slab_ns = run(slab_pool, num_ops, num_live, fifo);
+    printf("%s live:%d list:%.2f ns/op slab:%.2f ns/op speedup:%.2fx\n",
+           fifo ? "fifo" : "lifo", num_live, list_ns, slab_ns, list_ns / slab_ns);
+
+    delete list_pool;
+    delete slab_pool;
+  }
+
+  return 0;
+}
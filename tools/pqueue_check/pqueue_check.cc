@@ -0,0 +1,259 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/**********************************************************************************************
+ * File         : pqueue_check.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Replay queue operations against bucket_queue_c and the list based pqueue
+ *********************************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "bucket_queue.h"
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief previous pqueue_c storage (one sorted list per latency slot)
+///////////////////////////////////////////////////////////////////////////////////////////////
+class list_queue_c
+{
+  typedef struct list_entry_s {
+    int64_t m_priority;
+    long long m_data;
+  } list_entry_s;
+
+public:
+  list_queue_c(int capacity, int latency) {
+    m_last_index = latency;
+    m_current_index = 0;
+    m_num_entry = 0;
+    m_size = latency + 1;
+    m_entry = new list<list_entry_s>[m_size];
+  }
+
+  ~list_queue_c() {
+    delete[] m_entry;
+  }
+
+  bool ready() {
+    return !m_entry[m_current_index].empty();
+  }
+
+  void enqueue(int64_t priority, long long data) {
+    m_num_entry++;
+
+    list_entry_s new_entry = {priority, data};
+    for (auto I = m_entry[m_last_index].begin(), E = m_entry[m_last_index].end();
+         I != E; ++I) {
+      if (I->m_priority < priority) {
+        m_entry[m_last_index].insert(I, new_entry);
+        return;
+      }
+    }
+    m_entry[m_last_index].push_back(new_entry);
+  }
+
+  long long dequeue(int64_t* priority) {
+    list_entry_s entry = m_entry[m_current_index].front();
+    *priority = entry.m_priority;
+    m_entry[m_current_index].pop_front();
+    --m_num_entry;
+    return entry.m_data;
+  }
+
+  void advance() {
+    if (m_num_entry == 0) return;
+    if (!m_entry[m_current_index].empty()) return;
+
+    m_last_index = m_current_index;
+    m_current_index = (m_current_index + 1) % m_size;
+  }
+
+  bool settled() {
+    return m_num_entry == 0 || !m_entry[m_current_index].empty();
+  }
+
+  long long peek(int entry) {
+    long long data = 0;
+    int count = 0;
+    for (int ii = m_current_index; ii < m_current_index + m_size; ++ii) {
+      int index = ii % m_size;
+      for (auto I = m_entry[index].begin(), E = m_entry[index].end(); I != E; ++I) {
+        if (count++ == entry) {
+          data = I->m_data;
+          break;
+        }
+      }
+    }
+    return data;
+  }
+
+  int size() {
+    return m_num_entry;
+  }
+
+private:
+  list<list_entry_s>* m_entry;
+  int m_size;
+  int m_num_entry;
+  int m_last_index;
+  int m_current_index;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief apply the same operations to both queues and compare every result
+///////////////////////////////////////////////////////////////////////////////////////////////
+class checker_c
+{
+public:
+  checker_c(int capacity, int latency, string name)
+    : m_new(capacity, latency), m_old(capacity, latency), m_name(name), m_op(0),
+      m_capacity(capacity) {
+  }
+
+  // returns false on the first mismatch
+  bool apply(char op, int64_t priority, long long data) {
+    ++m_op;
+    switch (op) {
+      case 'E':
+        if (m_old.size() >= m_capacity) return true;
+        m_new.enqueue(priority, data);
+        m_old.enqueue(priority, data);
+        return check(m_new.size(), m_old.size(), "size");
+      case 'D': {
+        if (!m_old.ready()) return check(m_new.ready(), false, "ready");
+        int64_t new_priority, old_priority;
+        long long new_data = m_new.dequeue(&new_priority);
+        long long old_data = m_old.dequeue(&old_priority);
+        return check(new_data, old_data, "dequeue data") &&
+               check(new_priority, old_priority, "dequeue priority");
+      }
+      case 'A':
+        m_new.advance();
+        m_old.advance();
+        return check(m_new.settled(), m_old.settled(), "settled");
+      case 'P':
+        if (data > m_old.size()) return true;
+        return check(m_new.peek(data), m_old.peek(data), "peek");
+      case 'R':
+        return check(m_new.ready(), m_old.ready(), "ready");
+      default:
+        fprintf(stderr, "%s: unknown operation %c\n", m_name.c_str(), op);
+        return false;
+    }
+  }
+
+  long long num_ops() {
+    return m_op;
+  }
+
+private:
+  bool check(long long new_val, long long old_val, const char* what) {
+    if (new_val == old_val) return true;
+    fprintf(stderr, "%s: op %lld %s mismatch (bucket:%lld list:%lld)\n", m_name.c_str(),
+            m_op, what, new_val, old_val);
+    return false;
+  }
+
+  bucket_queue_c<long long> m_new;
+  list_queue_c m_old;
+  string m_name;
+  long long m_op;
+  int m_capacity;
+};
+
+// replay a sequence recorded from pqueue_c ("Q capacity latency" followed by
+// "E priority data", "D", "A", "P n", "R" lines)
+static bool replay(const char* file_name) {
+  ifstream file(file_name);
+  if (!file.good()) {
+    fprintf(stderr, "%s: cannot open\n", file_name);
+    return false;
+  }
+
+  char op;
+  int capacity, latency;
+  file >> op >> capacity >> latency;
+  checker_c checker(capacity, latency, file_name);
+
+  string line;
+  getline(file, line);
+  while (getline(file, line)) {
+    istringstream iss(line);
+    int64_t priority = 0;
+    long long data = 0;
+    iss >> op;
+    if (op == 'E') iss >> priority >> data;
+    if (op == 'P') iss >> data;
+    if (!checker.apply(op, priority, data)) return false;
+  }
+
+  printf("%s: %lld operations match\n", file_name, checker.num_ops());
+  return true;
+}
+
+// random sequences with mixed priorities, which the simulator itself never generates
+static bool random_sequences(int num_sequences) {
+  mt19937 rng(1);
+  for (int seq = 0; seq < num_sequences; ++seq) {
+    int capacity = 1 + rng() % 64;
+    int latency = rng() % 8;
+    checker_c checker(capacity, latency, "random" + to_string(seq));
+    for (int ii = 0; ii < 10000; ++ii) {
+      const char ops[] = "EEEDDAAPR";
+      char op = ops[rng() % (sizeof(ops) - 1)];
+      if (!checker.apply(op, rng() % 4, op == 'P' ? rng() % (capacity + 1) : ii)) {
+        return false;
+      }
+    }
+  }
+
+  printf("%d random sequences match\n", num_sequences);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  bool pass = true;
+  for (int ii = 1; ii < argc; ++ii) {
+    pass = replay(argv[ii]) && pass;
+  }
+  pass = random_sequences(1000) && pass;
+
+  printf("%s\n", pass ? "PASS" : "FAIL");
+  return pass ? 0 : 1;
+}
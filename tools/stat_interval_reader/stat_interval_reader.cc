@@ -0,0 +1,223 @@
+/*
+Copyright (c) <2012>, <Georgia Institute of Technology> All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted
+provided that the following conditions are met:
+
+Redistributions of source code must retain the above copyright notice, this list of conditions
+and the following disclaimer.
+
+Redistributions in binary form must reproduce the above copyright notice, this list of
+conditions and the following disclaimer in the documentation and/or other materials provided
+with the distribution.
+
+Neither the name of the <Georgia Institue of Technology> nor the names of its contributors
+may be used to endorse or promote products derived from this software without specific prior
+written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**********************************************************************************************
+ * File         : stat_interval_reader.cc
+ * Author       : HPArch Research Group
+ * Date         : 10/18/2026
+ * Description  : Convert an interval statistics file (stat_interval.bin) to CSV
+ *********************************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "stat_interval.h"
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: stat_interval_reader <file>                  summary\n"
+          "       stat_interval_reader <file> -l               list stat names\n"
+          "       stat_interval_reader <file> [-d] -a          all stats as CSV\n"
+          "       stat_interval_reader <file> [-d] <stat> ...  selected stats as CSV\n"
+          "  -d : per-interval changes instead of cumulative values\n");
+  exit(1);
+}
+
+// read an unsigned LEB128 varint (false past the end of the buffer)
+static bool get_varint(const char*& src, const char* end, uint64_t& value) {
+  value = 0;
+  for (int shift = 0; src < end && shift < 64; shift += 7) {
+    uint8_t byte = *src++;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+
+static bool read_name(FILE* file, string& name) {
+  uint16_t length;
+  if (fread(&length, sizeof(length), 1, file) != 1) return false;
+  name.resize(length);
+  return length == 0 || fread(&name[0], 1, length, file) == length;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) usage();
+
+  FILE* file = fopen(argv[1], "rb");
+  if (file == NULL) {
+    fprintf(stderr, "cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  stat_interval_header_s header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      header.m_magic != STAT_INTERVAL_MAGIC || header.m_version != STAT_INTERVAL_VERSION) {
+    fprintf(stderr, "%s is not an interval statistics file\n", argv[1]);
+    return 1;
+  }
+
+  // counter names in file order (per-core stats get their _CORE_<n> suffix)
+  vector<string> names(header.m_num_global);
+  vector<string> core_names(header.m_num_core_stat);
+  bool valid = true;
+  for (uint32_t ii = 0; ii < header.m_num_global; ++ii)
+    valid = valid && read_name(file, names[ii]);
+  for (uint32_t ii = 0; ii < header.m_num_core_stat; ++ii)
+    valid = valid && read_name(file, core_names[ii]);
+  if (!valid) {
+    fprintf(stderr, "%s: truncated stat names\n", argv[1]);
+    return 1;
+  }
+  for (uint32_t core = 0; core < header.m_num_core; ++core) {
+    char suffix[20];
+    sprintf(suffix, "_CORE_%u", core);
+    for (uint32_t ii = 0; ii < header.m_num_core_stat; ++ii)
+      names.push_back(core_names[ii] + suffix);
+  }
+
+  bool delta = false;
+  bool all = false;
+  bool list = false;
+  vector<int> columns;
+  map<string, int> index;
+  for (unsigned ii = 0; ii < names.size(); ++ii) index[names[ii]] = ii;
+
+  for (int ii = 2; ii < argc; ++ii) {
+    if (!strcmp(argv[ii], "-d")) {
+      delta = true;
+    } else if (!strcmp(argv[ii], "-a")) {
+      all = true;
+    } else if (!strcmp(argv[ii], "-l")) {
+      list = true;
+    } else if (index.find(argv[ii]) != index.end()) {
+      columns.push_back(index[argv[ii]]);
+    } else {
+      fprintf(stderr, "unknown stat %s\n", argv[ii]);
+      return 1;
+    }
+  }
+
+  if (list) {
+    for (auto I = names.begin(), E = names.end(); I != E; ++I) printf("%s\n", (*I).c_str());
+    return 0;
+  }
+
+  if (all) {
+    columns.clear();
+    for (unsigned ii = 0; ii < names.size(); ++ii) columns.push_back(ii);
+  }
+
+  bool csv = !columns.empty();
+  if (csv) {
+    printf("cycle,insts");
+    for (auto I = columns.begin(), E = columns.end(); I != E; ++I)
+      printf(",%s", names[*I].c_str());
+    printf("\n");
+  }
+
+  vector<uint64_t> counts(names.size(), 0);
+  vector<uint64_t> prev(names.size(), 0);
+  vector<char> payload;
+  uint64_t num_snapshot = 0;
+  uint64_t cycle = 0;
+  uint64_t insts = 0;
+  bool truncated = false;
+
+  while (true) {
+    uint32_t size;
+    if (fread(&size, sizeof(size), 1, file) != 1) break;
+    payload.resize(size);
+    if (size && fread(payload.data(), 1, size, file) != size) {
+      truncated = true;
+      break;
+    }
+
+    const char* src = payload.data();
+    const char* end = src + size;
+    uint64_t snapshot_cycle, snapshot_insts, num_changed;
+    if (!get_varint(src, end, snapshot_cycle) || !get_varint(src, end, snapshot_insts) ||
+        !get_varint(src, end, num_changed)) {
+      truncated = true;
+      break;
+    }
+
+    if (delta) prev = counts;
+
+    uint64_t position = 0;
+    for (uint64_t ii = 0; ii < num_changed; ++ii) {
+      uint64_t gap, zigzag;
+      if (!get_varint(src, end, gap) || !get_varint(src, end, zigzag)) {
+        truncated = true;
+        break;
+      }
+      position += gap;
+      if (position >= counts.size()) {
+        truncated = true;
+        break;
+      }
+      int64_t change = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+      counts[position] += change;
+    }
+    if (truncated) break;
+
+    cycle = snapshot_cycle;
+    insts = snapshot_insts;
+    ++num_snapshot;
+    if (csv) {
+      printf("%llu,%llu", (unsigned long long)cycle, (unsigned long long)insts);
+      for (auto I = columns.begin(), E = columns.end(); I != E; ++I) {
+        uint64_t value = delta ? counts[*I] - prev[*I] : counts[*I];
+        printf(",%lld", (long long)value);
+      }
+      printf("\n");
+    }
+  }
+  fclose(file);
+
+  if (truncated) fprintf(stderr, "dropped a partial snapshot at the end of the file\n");
+
+  if (!csv) {
+    printf("cores          : %u\n", header.m_num_core);
+    printf("global stats   : %u\n", header.m_num_global);
+    printf("per-core stats : %u\n", header.m_num_core_stat);
+    printf("snapshots      : %llu\n", (unsigned long long)num_snapshot);
+    printf("last cycle     : %llu\n", (unsigned long long)cycle);
+    printf("last insts     : %llu\n", (unsigned long long)insts);
+  }
+
+  return 0;
+}
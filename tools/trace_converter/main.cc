@@ -28,6 +28,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <cassert>
+#include <cstddef>
 #include <fstream>
 #include <zlib.h>
 #include <cstring>
@@ -36,6 +37,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "knob.h"
 #include "trace_read_conv.h"
 #include "trace_converter.h"
+#include "block_trace.h"
 
 #define ASSERTM(cond, args...)                                    \
 do {                                                              \
@@ -187,6 +189,108 @@ int read_trace(string trace_path, int truncate_size)
 }
 
 
+// describe the raw record of a trace type for delta encoding
+// static fields are not listed; they become raw fields that are stored once per pc
+#define DELTA_FIELD(type, field, kind) \
+  codec.add_field(offsetof(type, field), sizeof(((type*)0)->field), kind)
+
+bool set_delta_layout(delta_trace_codec_c& codec, string trace_type)
+{
+  if (trace_type == "x86") {
+    DELTA_FIELD(trace_info_cpu_s, m_ld_vaddr1, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_cpu_s, m_ld_vaddr2, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_cpu_s, m_st_vaddr, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_cpu_s, m_instruction_addr, DELTA_FIELD_PC);
+    DELTA_FIELD(trace_info_cpu_s, m_branch_target, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_cpu_s, m_rep_dir, DELTA_FIELD_RAW);
+    DELTA_FIELD(trace_info_cpu_s, m_actually_taken, DELTA_FIELD_RAW);
+    return codec.set_record_size(CPU_TRACE_SIZE);
+  } else if (trace_type == "a64") {
+    DELTA_FIELD(trace_info_a64_s, m_ld_vaddr1, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_a64_s, m_ld_vaddr2, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_a64_s, m_st_vaddr, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_a64_s, m_instruction_addr, DELTA_FIELD_PC);
+    DELTA_FIELD(trace_info_a64_s, m_branch_target, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_a64_s, m_rep_dir, DELTA_FIELD_RAW);
+    DELTA_FIELD(trace_info_a64_s, m_actually_taken, DELTA_FIELD_RAW);
+    return codec.set_record_size(sizeof(trace_info_a64_s) - sizeof(uint64_t));
+  } else if (trace_type == "gpu") {
+    DELTA_FIELD(trace_info_gpu_small_s, m_active_mask, DELTA_FIELD_RAW);
+    DELTA_FIELD(trace_info_gpu_small_s, m_br_taken_mask, DELTA_FIELD_RAW);
+    DELTA_FIELD(trace_info_gpu_small_s, m_inst_addr, DELTA_FIELD_PC);
+    DELTA_FIELD(trace_info_gpu_small_s, m_br_target_addr, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_gpu_small_s, m_mem_addr, DELTA_FIELD_ADDR);
+    return codec.set_record_size(GPU_TRACE_SIZE);
+  } else if (trace_type == "nvbit") {
+    DELTA_FIELD(trace_info_nvbit_small_s, m_active_mask, DELTA_FIELD_RAW);
+    DELTA_FIELD(trace_info_nvbit_small_s, m_br_taken_mask, DELTA_FIELD_RAW);
+    DELTA_FIELD(trace_info_nvbit_small_s, m_inst_addr, DELTA_FIELD_PC);
+    DELTA_FIELD(trace_info_nvbit_small_s, m_br_target_addr, DELTA_FIELD_ADDR);
+    DELTA_FIELD(trace_info_nvbit_small_s, m_mem_addr, DELTA_FIELD_ADDR);
+    return codec.set_record_size(NVBIT_TRACE_SIZE);
+  }
+
+  return false;
+}
+
+
+// convert a gzip thread trace (.raw) into a seekable block trace
+// when output_path is empty, the input file is replaced
+// when trace_type is given, records are delta-encoded with the layout of that trace type
+int convert_block_trace(string input_path, string output_path, int block_records,
+                        string trace_type = "")
+{
+  if (block_trace_reader_c::is_block_trace(input_path)) {
+    cout << "> " << input_path << " is already a block trace\n";
+    return 0;
+  }
+
+  bool in_place = output_path.empty();
+  if (in_place)
+    output_path = input_path + ".blk";
+
+  gzFile gztrace = gzopen(input_path.c_str(), "r");
+  ASSERTM(gztrace != NULL, "cannot open %s\n", input_path.c_str());
+
+  delta_trace_codec_c codec;
+  unsigned record_size = TRACE_SIZE;
+  if (!trace_type.empty()) {
+    ASSERTM(set_delta_layout(codec, trace_type), "unknown trace type %s\n",
+            trace_type.c_str());
+    record_size = codec.get_record_size();
+  }
+
+  block_trace_writer_c writer;
+  ASSERTM(writer.open(output_path, block_records * record_size,
+                      trace_type.empty() ? NULL : &codec),
+          "cannot create %s\n", output_path.c_str());
+
+  const int buffer_size = 1 << 20;
+  char* buffer = new char[buffer_size];
+  int64_t total = 0;
+  int byte_read;
+  while ((byte_read = gzread(gztrace, buffer, buffer_size)) > 0) {
+    ASSERTM(writer.write(buffer, byte_read), "write error on %s\n", output_path.c_str());
+    total += byte_read;
+  }
+  ASSERTM(byte_read == 0, "read error on %s\n", input_path.c_str());
+  delete[] buffer;
+
+  gzclose(gztrace);
+  ASSERTM(writer.close(), "write error on %s\n", output_path.c_str());
+
+  if (in_place) {
+    ASSERTM(rename(output_path.c_str(), input_path.c_str()) == 0, "cannot replace %s\n",
+            input_path.c_str());
+    output_path = input_path;
+  }
+
+  cout << "> " << output_path << ": " << total / record_size << " instructions\n";
+
+  return 0;
+}
+
+
 void register_trace_reader(void)
 {
   trace_reader_c::Singleton.init();
@@ -209,6 +313,38 @@ int main(int argc, char* argv[])
     exit(0);
   }
 
+  // block trace conversion : -block <input.raw> [output.raw] [instructions per block]
+  if (string(argv[1]) == "-block") {
+    if (argc < 3) {
+      cout << "> error: specify thread trace (.raw) path\n";
+      exit(0);
+    }
+    string output_path = (argc > 3) ? argv[3] : "";
+    int block_records = (argc > 4) ? atoi(argv[4]) : 4096;
+
+    return convert_block_trace(argv[2], output_path, block_records);
+  }
+
+  // delta trace conversion :
+  // -delta <input.raw> [output.raw] [instructions per block] [x86|a64|gpu|nvbit]
+  if (string(argv[1]) == "-delta") {
+    if (argc < 3) {
+      cout << "> error: specify thread trace (.raw) path\n";
+      exit(0);
+    }
+    string output_path = (argc > 3) ? argv[3] : "";
+    int block_records = (argc > 4) ? atoi(argv[4]) : 4096;
+#if defined(GPU_TRACE)
+    string trace_type = (argc > 5) ? argv[5] : "gpu";
+#elif defined(ARM64_TRACE)
+    string trace_type = (argc > 5) ? argv[5] : "a64";
+#else
+    string trace_type = (argc > 5) ? argv[5] : "x86";
+#endif
+
+    return convert_block_trace(argv[2], output_path, block_records, trace_type);
+  }
+
   if (argc  == 3) { 
     truncate_size = atoi(argv[2]); 
   }
@@ -62,8 +62,11 @@ POSSIBILITY OF SUCH DAMAGE.
 #define MAX_DST_NUM 6
 #define MAX_GPU_SRC_NUM 5
 #define MAX_GPU_DST_NUM 4
+#define MAX_NVBIT_SRC_NUM 4
+#define MAX_NVBIT_DST_NUM 4
 #define CPU_TRACE_SIZE (sizeof(trace_info_cpu_s) - sizeof(uint64_t))
 #define GPU_TRACE_SIZE (sizeof(trace_info_gpu_small_s))
+#define NVBIT_TRACE_SIZE (sizeof(trace_info_nvbit_small_s))
 #define MAX_TR_OPCODE 452 // ARM_INS_ENDING
 
 
@@ -227,6 +230,40 @@ typedef struct trace_info_gpu_s {
 } trace_info_gpu_s;
 
 
+// the same structure as the nvbit trace generator
+typedef struct trace_info_nvbit_small_s {
+  uint8_t m_opcode;
+  bool m_is_fp;
+  bool m_is_load;
+  uint8_t m_cf_type;
+  uint8_t m_num_read_regs;
+  uint8_t m_num_dest_regs;
+  uint16_t m_src[MAX_NVBIT_SRC_NUM];
+  uint16_t m_dst[MAX_NVBIT_DST_NUM];
+  uint8_t m_size;
+
+  uint32_t m_active_mask;
+  uint32_t m_br_taken_mask;
+  uint64_t m_inst_addr;
+  uint64_t m_br_target_addr;
+  union {
+    uint64_t m_reconv_inst_addr;
+    uint64_t m_mem_addr;
+  };
+  union {
+    uint8_t m_mem_access_size;
+    uint8_t m_barrier_id;
+  };
+  uint16_t m_num_barrier_threads;
+  union {
+    uint8_t m_addr_space; //for loads, stores, atomic, prefetch(?)
+    uint8_t m_level; //for membar
+  };
+  uint8_t m_cache_level; //for prefetch?
+  uint8_t m_cache_operator; //for loads, stores, atomic, prefetch(?)
+} trace_info_nvbit_small_s;
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief structure to hold decoded uop information
 ///